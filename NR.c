@@ -0,0 +1,498 @@
+#define LINUX_SYSTEM_CALL_SLOTS 512
+#define LINUX_SYSTEM_CALL_BUCKETS 128
+
+static const unsigned short linux_system_call_displacements[LINUX_SYSTEM_CALL_BUCKETS] = {
+	5,
+	6,
+	0,
+	1,
+	0,
+	14,
+	1,
+	0,
+	0,
+	4,
+	1,
+	2,
+	0,
+	3,
+	2,
+	2,
+	2,
+	0,
+	1,
+	1,
+	3,
+	0,
+	0,
+	3,
+	0,
+	2,
+	5,
+	1,
+	0,
+	3,
+	0,
+	3,
+	1,
+	0,
+	4,
+	1,
+	0,
+	8,
+	3,
+	5,
+	5,
+	13,
+	0,
+	1,
+	9,
+	0,
+	7,
+	0,
+	0,
+	1,
+	3,
+	1,
+	13,
+	1,
+	9,
+	9,
+	1,
+	0,
+	0,
+	1,
+	5,
+	0,
+	1,
+	3,
+	1,
+	0,
+	9,
+	3,
+	0,
+	9,
+	1,
+	5,
+	0,
+	4,
+	0,
+	0,
+	1,
+	0,
+	0,
+	2,
+	2,
+	3,
+	0,
+	4,
+	8,
+	0,
+	5,
+	21,
+	3,
+	13,
+	0,
+	0,
+	4,
+	6,
+	1,
+	1,
+	0,
+	0,
+	1,
+	1,
+	41,
+	11,
+	11,
+	7,
+	0,
+	3,
+	2,
+	0,
+	0,
+	25,
+	3,
+	13,
+	3,
+	7,
+	9,
+	4,
+	2,
+	2,
+	12,
+	1,
+	1,
+	0,
+	2,
+	6,
+	0,
+	0,
+	14,
+	8,
+};
+
+static const struct linux_system_call linux_system_calls[LINUX_SYSTEM_CALL_SLOTS] = {
+	[2] = { "times", 5, __NR_times },
+	[3] = { "io_uring_setup", 14, __NR_io_uring_setup },
+	[5] = { "ioprio_set", 10, __NR_ioprio_set },
+	[6] = { "getcpu", 6, __NR_getcpu },
+	[7] = { "clock_gettime", 13, __NR_clock_gettime },
+	[10] = { "epoll_create1", 13, __NR_epoll_create1 },
+	[12] = { "getrusage", 9, __NR_getrusage },
+	[13] = { "fsetxattr", 9, __NR_fsetxattr },
+	[15] = { "fdatasync", 9, __NR_fdatasync },
+	[16] = { "rmdir", 5, __NR_rmdir },
+	[17] = { "sendfile", 8, __NR_sendfile },
+	[18] = { "utimensat", 9, __NR_utimensat },
+	[19] = { "perf_event_open", 15, __NR_perf_event_open },
+	[22] = { "timerfd_gettime", 15, __NR_timerfd_gettime },
+	[23] = { "vfork", 5, __NR_vfork },
+	[25] = { "openat2", 7, __NR_openat2 },
+	[26] = { "vmsplice", 8, __NR_vmsplice },
+	[27] = { "utimes", 6, __NR_utimes },
+	[28] = { "pivot_root", 10, __NR_pivot_root },
+	[29] = { "ptrace", 6, __NR_ptrace },
+	[30] = { "shmat", 5, __NR_shmat },
+	[31] = { "symlinkat", 9, __NR_symlinkat },
+	[33] = { "creat", 5, __NR_creat },
+	[34] = { "nanosleep", 9, __NR_nanosleep },
+	[37] = { "inotify_rm_watch", 16, __NR_inotify_rm_watch },
+	[41] = { "mlock", 5, __NR_mlock },
+	[42] = { "sched_setparam", 14, __NR_sched_setparam },
+	[45] = { "readlinkat", 10, __NR_readlinkat },
+	[46] = { "inotify_add_watch", 17, __NR_inotify_add_watch },
+	[47] = { "shmctl", 6, __NR_shmctl },
+	[48] = { "io_uring_enter", 14, __NR_io_uring_enter },
+	[51] = { "socketpair", 10, __NR_socketpair },
+	[52] = { "mknodat", 7, __NR_mknodat },
+	[54] = { "renameat", 8, __NR_renameat },
+	[55] = { "epoll_pwait", 11, __NR_epoll_pwait },
+	[58] = { "mq_notify", 9, __NR_mq_notify },
+	[59] = { "userfaultfd", 11, __NR_userfaultfd },
+	[61] = { "ustat", 5, __NR_ustat },
+	[62] = { "move_mount", 10, __NR_move_mount },
+	[63] = { "execveat", 8, __NR_execveat },
+	[64] = { "setsid", 6, __NR_setsid },
+	[66] = { "mq_timedreceive", 15, __NR_mq_timedreceive },
+	[69] = { "fstatfs", 7, __NR_fstatfs },
+	[71] = { "getpid", 6, __NR_getpid },
+	[72] = { "setgid", 6, __NR_setgid },
+	[73] = { "tkill", 5, __NR_tkill },
+	[74] = { "getpgrp", 7, __NR_getpgrp },
+	[75] = { "uselib", 6, __NR_uselib },
+	[76] = { "open_by_handle_at", 17, __NR_open_by_handle_at },
+	[77] = { "pwritev", 7, __NR_pwritev },
+	[79] = { "acct", 4, __NR_acct },
+	[81] = { "msgrcv", 6, __NR_msgrcv },
+	[82] = { "fanotify_mark", 13, __NR_fanotify_mark },
+	[83] = { "clock_settime", 13, __NR_clock_settime },
+	[86] = { "mount", 5, __NR_mount },
+	[88] = { "open_tree", 9, __NR_open_tree },
+	[89] = { "openat", 6, __NR_openat },
+	[90] = { "socket", 6, __NR_socket },
+	[91] = { "swapon", 6, __NR_swapon },
+	[94] = { "keyctl", 6, __NR_keyctl },
+	[95] = { "symlink", 7, __NR_symlink },
+	[97] = { "setgroups", 9, __NR_setgroups },
+	[98] = { "munmap", 6, __NR_munmap },
+	[99] = { "pkey_free", 9, __NR_pkey_free },
+	[100] = { "arch_prctl", 10, __NR_arch_prctl },
+	[104] = { "setpgid", 7, __NR_setpgid },
+	[105] = { "msync", 5, __NR_msync },
+	[110] = { "getrlimit", 9, __NR_getrlimit },
+	[113] = { "umount2", 7, __NR_umount2 },
+	[114] = { "brk", 3, __NR_brk },
+	[115] = { "waitid", 6, __NR_waitid },
+	[116] = { "sched_rr_get_interval", 21, __NR_sched_rr_get_interval },
+	[119] = { "setdomainname", 13, __NR_setdomainname },
+	[121] = { "renameat2", 9, __NR_renameat2 },
+	[122] = { "accept", 6, __NR_accept },
+	[123] = { "semop", 5, __NR_semop },
+	[124] = { "sched_yield", 11, __NR_sched_yield },
+	[125] = { "exit", 4, __NR_exit },
+	[126] = { "remap_file_pages", 16, __NR_remap_file_pages },
+	[127] = { "getsockopt", 10, __NR_getsockopt },
+	[128] = { "clock_getres", 12, __NR_clock_getres },
+	[129] = { "process_madvise", 15, __NR_process_madvise },
+	[131] = { "vserver", 7, __NR_vserver },
+	[132] = { "signalfd", 8, __NR_signalfd },
+	[134] = { "open", 4, __NR_open },
+	[135] = { "set_thread_area", 15, __NR_set_thread_area },
+	[136] = { "msgctl", 6, __NR_msgctl },
+	[137] = { "pidfd_getfd", 11, __NR_pidfd_getfd },
+	[138] = { "getgroups", 9, __NR_getgroups },
+	[139] = { "tuxcall", 7, __NR_tuxcall },
+	[140] = { "getpmsg", 7, __NR_getpmsg },
+	[141] = { "get_robust_list", 15, __NR_get_robust_list },
+	[142] = { "getgid", 6, __NR_getgid },
+	[143] = { "lchown", 6, __NR_lchown },
+	[144] = { "sendmmsg", 8, __NR_sendmmsg },
+	[145] = { "fallocate", 9, __NR_fallocate },
+	[146] = { "pipe", 4, __NR_pipe },
+	[147] = { "seccomp", 7, __NR_seccomp },
+	[148] = { "epoll_wait_old", 14, __NR_epoll_wait_old },
+	[149] = { "getsid", 6, __NR_getsid },
+	[150] = { "prctl", 5, __NR_prctl },
+	[151] = { "move_pages", 10, __NR_move_pages },
+	[152] = { "unlink", 6, __NR_unlink },
+	[153] = { "fremovexattr", 12, __NR_fremovexattr },
+	[154] = { "mkdir", 5, __NR_mkdir },
+	[155] = { "msgsnd", 6, __NR_msgsnd },
+	[156] = { "rt_sigprocmask", 14, __NR_rt_sigprocmask },
+	[158] = { "writev", 6, __NR_writev },
+	[159] = { "sched_getscheduler", 18, __NR_sched_getscheduler },
+	[160] = { "kcmp", 4, __NR_kcmp },
+	[163] = { "readv", 5, __NR_readv },
+	[164] = { "request_key", 11, __NR_request_key },
+	[165] = { "kill", 4, __NR_kill },
+	[166] = { "getpriority", 11, __NR_getpriority },
+	[171] = { "madvise", 7, __NR_madvise },
+	[173] = { "timer_gettime", 13, __NR_timer_gettime },
+	[174] = { "settimeofday", 12, __NR_settimeofday },
+	[176] = { "unshare", 7, __NR_unshare },
+	[177] = { "dup2", 4, __NR_dup2 },
+	[179] = { "preadv2", 7, __NR_preadv2 },
+	[180] = { "getrandom", 9, __NR_getrandom },
+	[181] = { "dup3", 4, __NR_dup3 },
+	[182] = { "clone", 5, __NR_clone },
+	[183] = { "memfd_secret", 12, __NR_memfd_secret },
+	[184] = { "getsockname", 11, __NR_getsockname },
+	[185] = { "finit_module", 12, __NR_finit_module },
+	[186] = { "landlock_create_ruleset", 23, __NR_landlock_create_ruleset },
+	[187] = { "quotactl", 8, __NR_quotactl },
+	[189] = { "mknod", 5, __NR_mknod },
+	[191] = { "sendmsg", 7, __NR_sendmsg },
+	[192] = { "sched_getparam", 14, __NR_sched_getparam },
+	[193] = { "setresuid", 9, __NR_setresuid },
+	[194] = { "pkey_mprotect", 13, __NR_pkey_mprotect },
+	[195] = { "getxattr", 8, __NR_getxattr },
+	[196] = { "io_pgetevents", 13, __NR_io_pgetevents },
+	[197] = { "mkdirat", 7, __NR_mkdirat },
+	[199] = { "set_tid_address", 15, __NR_set_tid_address },
+	[200] = { "add_key", 7, __NR_add_key },
+	[201] = { "prlimit64", 9, __NR_prlimit64 },
+	[202] = { "sysinfo", 7, __NR_sysinfo },
+	[203] = { "gettid", 6, __NR_gettid },
+	[207] = { "sched_get_priority_max", 22, __NR_sched_get_priority_max },
+	[208] = { "pause", 5, __NR_pause },
+	[210] = { "tee", 3, __NR_tee },
+	[211] = { "epoll_pwait2", 12, __NR_epoll_pwait2 },
+	[212] = { "adjtimex", 8, __NR_adjtimex },
+	[213] = { "uname", 5, __NR_uname },
+	[214] = { "readahead", 9, __NR_readahead },
+	[216] = { "umask", 5, __NR_umask },
+	[217] = { "listen", 6, __NR_listen },
+	[218] = { "removexattr", 11, __NR_removexattr },
+	[220] = { "shmget", 6, __NR_shmget },
+	[221] = { "getdents64", 10, __NR_getdents64 },
+	[222] = { "shutdown", 8, __NR_shutdown },
+	[223] = { "pkey_alloc", 10, __NR_pkey_alloc },
+	[224] = { "iopl", 4, __NR_iopl },
+	[226] = { "ioctl", 5, __NR_ioctl },
+	[227] = { "getppid", 7, __NR_getppid },
+	[229] = { "reboot", 6, __NR_reboot },
+	[230] = { "_sysctl", 7, __NR__sysctl },
+	[231] = { "clock_adjtime", 13, __NR_clock_adjtime },
+	[232] = { "sched_getaffinity", 17, __NR_sched_getaffinity },
+	[235] = { "mq_unlink", 9, __NR_mq_unlink },
+	[236] = { "setpriority", 11, __NR_setpriority },
+	[237] = { "process_vm_readv", 16, __NR_process_vm_readv },
+	[238] = { "membarrier", 10, __NR_membarrier },
+	[239] = { "get_thread_area", 15, __NR_get_thread_area },
+	[240] = { "statfs", 6, __NR_statfs },
+	[241] = { "setregid", 8, __NR_setregid },
+	[242] = { "geteuid", 7, __NR_geteuid },
+	[243] = { "faccessat2", 10, __NR_faccessat2 },
+	[245] = { "io_setup", 8, __NR_io_setup },
+	[246] = { "io_cancel", 9, __NR_io_cancel },
+	[249] = { "mq_open", 7, __NR_mq_open },
+	[250] = { "pwrite64", 8, __NR_pwrite64 },
+	[251] = { "syncfs", 6, __NR_syncfs },
+	[253] = { "lstat", 5, __NR_lstat },
+	[254] = { "unlinkat", 8, __NR_unlinkat },
+	[256] = { "mlock2", 6, __NR_mlock2 },
+	[257] = { "epoll_wait", 10, __NR_epoll_wait },
+	[260] = { "restart_syscall", 15, __NR_restart_syscall },
+	[261] = { "timer_delete", 12, __NR_timer_delete },
+	[262] = { "mprotect", 8, __NR_mprotect },
+	[263] = { "fchmod", 6, __NR_fchmod },
+	[266] = { "flistxattr", 10, __NR_flistxattr },
+	[267] = { "sched_setscheduler", 18, __NR_sched_setscheduler },
+	[268] = { "lookup_dcookie", 14, __NR_lookup_dcookie },
+	[269] = { "rt_sigaction", 12, __NR_rt_sigaction },
+	[271] = { "sched_setattr", 13, __NR_sched_setattr },
+	[274] = { "llistxattr", 10, __NR_llistxattr },
+	[275] = { "access", 6, __NR_access },
+	[276] = { "capget", 6, __NR_capget },
+	[277] = { "clock_nanosleep", 15, __NR_clock_nanosleep },
+	[278] = { "setitimer", 9, __NR_setitimer },
+	[279] = { "getuid", 6, __NR_getuid },
+	[282] = { "semget", 6, __NR_semget },
+	[283] = { "fchmodat", 8, __NR_fchmodat },
+	[284] = { "pselect6", 8, __NR_pselect6 },
+	[285] = { "pipe2", 5, __NR_pipe2 },
+	[286] = { "timerfd_settime", 15, __NR_timerfd_settime },
+	[287] = { "mlockall", 8, __NR_mlockall },
+	[288] = { "setreuid", 8, __NR_setreuid },
+	[289] = { "rt_tgsigqueueinfo", 17, __NR_rt_tgsigqueueinfo },
+	[290] = { "eventfd2", 8, __NR_eventfd2 },
+	[292] = { "mmap", 4, __NR_mmap },
+	[293] = { "flock", 5, __NR_flock },
+	[294] = { "getcwd", 6, __NR_getcwd },
+	[295] = { "time", 4, __NR_time },
+	[296] = { "pread64", 7, __NR_pread64 },
+	[297] = { "delete_module", 13, __NR_delete_module },
+	[298] = { "setfsuid", 8, __NR_setfsuid },
+	[300] = { "security", 8, __NR_security },
+	[301] = { "syslog", 6, __NR_syslog },
+	[302] = { "tgkill", 6, __NR_tgkill },
+	[304] = { "getitimer", 9, __NR_getitimer },
+	[305] = { "nfsservctl", 10, __NR_nfsservctl },
+	[306] = { "wait4", 5, __NR_wait4 },
+	[307] = { "semctl", 6, __NR_semctl },
+	[310] = { "close", 5, __NR_close },
+	[311] = { "ioperm", 6, __NR_ioperm },
+	[312] = { "getegid", 7, __NR_getegid },
+	[313] = { "create_module", 13, __NR_create_module },
+	[315] = { "fchownat", 8, __NR_fchownat },
+	[317] = { "fspick", 6, __NR_fspick },
+	[318] = { "sigaltstack", 11, __NR_sigaltstack },
+	[319] = { "alarm", 5, __NR_alarm },
+	[321] = { "eventfd", 7, __NR_eventfd },
+	[323] = { "lsetxattr", 9, __NR_lsetxattr },
+	[324] = { "munlock", 7, __NR_munlock },
+	[326] = { "timer_getoverrun", 16, __NR_timer_getoverrun },
+	[328] = { "lseek", 5, __NR_lseek },
+	[331] = { "fork", 4, __NR_fork },
+	[332] = { "fsmount", 7, __NR_fsmount },
+	[334] = { "exit_group", 10, __NR_exit_group },
+	[335] = { "sched_get_priority_min", 22, __NR_sched_get_priority_min },
+	[337] = { "semtimedop", 10, __NR_semtimedop },
+	[339] = { "modify_ldt", 10, __NR_modify_ldt },
+	[341] = { "ppoll", 5, __NR_ppoll },
+	[342] = { "memfd_create", 12, __NR_memfd_create },
+	[343] = { "statx", 5, __NR_statx },
+	[344] = { "setxattr", 8, __NR_setxattr },
+	[345] = { "setuid", 6, __NR_setuid },
+	[348] = { "stat", 4, __NR_stat },
+	[349] = { "write", 5, __NR_write },
+	[353] = { "gettimeofday", 12, __NR_gettimeofday },
+	[354] = { "chdir", 5, __NR_chdir },
+	[356] = { "accept4", 7, __NR_accept4 },
+	[357] = { "fcntl", 5, __NR_fcntl },
+	[358] = { "recvfrom", 8, __NR_recvfrom },
+	[359] = { "lremovexattr", 12, __NR_lremovexattr },
+	[360] = { "rt_sigsuspend", 13, __NR_rt_sigsuspend },
+	[363] = { "capset", 6, __NR_capset },
+	[364] = { "putpmsg", 7, __NR_putpmsg },
+	[365] = { "swapoff", 7, __NR_swapoff },
+	[366] = { "kexec_file_load", 15, __NR_kexec_file_load },
+	[367] = { "rt_sigtimedwait", 15, __NR_rt_sigtimedwait },
+	[370] = { "rt_sigpending", 13, __NR_rt_sigpending },
+	[371] = { "process_mrelease", 16, __NR_process_mrelease },
+	[373] = { "landlock_restrict_self", 22, __NR_landlock_restrict_self },
+	[374] = { "getresuid", 9, __NR_getresuid },
+	[375] = { "io_uring_register", 17, __NR_io_uring_register },
+	[376] = { "mincore", 7, __NR_mincore },
+	[377] = { "dup", 3, __NR_dup },
+	[379] = { "chmod", 5, __NR_chmod },
+	[380] = { "get_mempolicy", 13, __NR_get_mempolicy },
+	[381] = { "timer_settime", 13, __NR_timer_settime },
+	[382] = { "readlink", 8, __NR_readlink },
+	[384] = { "fgetxattr", 9, __NR_fgetxattr },
+	[385] = { "io_getevents", 12, __NR_io_getevents },
+	[386] = { "mbind", 5, __NR_mbind },
+	[387] = { "connect", 7, __NR_connect },
+	[390] = { "signalfd4", 9, __NR_signalfd4 },
+	[391] = { "poll", 4, __NR_poll },
+	[392] = { "inotify_init", 12, __NR_inotify_init },
+	[393] = { "rt_sigreturn", 12, __NR_rt_sigreturn },
+	[394] = { "set_mempolicy", 13, __NR_set_mempolicy },
+	[396] = { "fadvise64", 9, __NR_fadvise64 },
+	[397] = { "pidfd_send_signal", 17, __NR_pidfd_send_signal },
+	[398] = { "getpgid", 7, __NR_getpgid },
+	[399] = { "fsync", 5, __NR_fsync },
+	[401] = { "fchown", 6, __NR_fchown },
+	[402] = { "setfsgid", 8, __NR_setfsgid },
+	[403] = { "splice", 6, __NR_splice },
+	[405] = { "quotactl_fd", 11, __NR_quotactl_fd },
+	[406] = { "fsopen", 6, __NR_fsopen },
+	[409] = { "recvmsg", 7, __NR_recvmsg },
+	[410] = { "futimesat", 9, __NR_futimesat },
+	[411] = { "mq_getsetattr", 13, __NR_mq_getsetattr },
+	[413] = { "sendto", 6, __NR_sendto },
+	[414] = { "inotify_init1", 13, __NR_inotify_init1 },
+	[415] = { "fstat", 5, __NR_fstat },
+	[417] = { "mq_timedsend", 12, __NR_mq_timedsend },
+	[420] = { "utime", 5, __NR_utime },
+	[421] = { "personality", 11, __NR_personality },
+	[422] = { "fsconfig", 8, __NR_fsconfig },
+	[423] = { "io_destroy", 10, __NR_io_destroy },
+	[424] = { "timerfd_create", 14, __NR_timerfd_create },
+	[426] = { "init_module", 11, __NR_init_module },
+	[428] = { "sysfs", 5, __NR_sysfs },
+	[430] = { "futex", 5, __NR_futex },
+	[432] = { "mount_setattr", 13, __NR_mount_setattr },
+	[433] = { "futex_waitv", 11, __NR_futex_waitv },
+	[434] = { "vhangup", 7, __NR_vhangup },
+	[435] = { "listxattr", 9, __NR_listxattr },
+	[437] = { "clone3", 6, __NR_clone3 },
+	[438] = { "getpeername", 11, __NR_getpeername },
+	[439] = { "epoll_create", 12, __NR_epoll_create },
+	[440] = { "execve", 6, __NR_execve },
+	[441] = { "landlock_add_rule", 17, __NR_landlock_add_rule },
+	[442] = { "truncate", 8, __NR_truncate },
+	[443] = { "getresgid", 9, __NR_getresgid },
+	[445] = { "pidfd_open", 10, __NR_pidfd_open },
+	[447] = { "rseq", 4, __NR_rseq },
+	[450] = { "read", 4, __NR_read },
+	[451] = { "process_vm_writev", 17, __NR_process_vm_writev },
+	[452] = { "chown", 5, __NR_chown },
+	[453] = { "getdents", 8, __NR_getdents },
+	[455] = { "fchdir", 6, __NR_fchdir },
+	[458] = { "bind", 4, __NR_bind },
+	[459] = { "ftruncate", 9, __NR_ftruncate },
+	[460] = { "link", 4, __NR_link },
+	[461] = { "sched_getattr", 13, __NR_sched_getattr },
+	[462] = { "close_range", 11, __NR_close_range },
+	[463] = { "afs_syscall", 11, __NR_afs_syscall },
+	[465] = { "preadv", 6, __NR_preadv },
+	[466] = { "sync", 4, __NR_sync },
+	[468] = { "ioprio_get", 10, __NR_ioprio_get },
+	[469] = { "get_kernel_syms", 15, __NR_get_kernel_syms },
+	[471] = { "migrate_pages", 13, __NR_migrate_pages },
+	[472] = { "chroot", 6, __NR_chroot },
+	[473] = { "bpf", 3, __NR_bpf },
+	[474] = { "setns", 5, __NR_setns },
+	[476] = { "lgetxattr", 9, __NR_lgetxattr },
+	[477] = { "mremap", 6, __NR_mremap },
+	[478] = { "kexec_load", 10, __NR_kexec_load },
+	[479] = { "select", 6, __NR_select },
+	[480] = { "fanotify_init", 13, __NR_fanotify_init },
+	[481] = { "epoll_ctl_old", 13, __NR_epoll_ctl_old },
+	[482] = { "setrlimit", 9, __NR_setrlimit },
+	[483] = { "setsockopt", 10, __NR_setsockopt },
+	[484] = { "sched_setaffinity", 17, __NR_sched_setaffinity },
+	[485] = { "linkat", 6, __NR_linkat },
+	[486] = { "io_submit", 9, __NR_io_submit },
+	[487] = { "set_mempolicy_home_node", 23, __NR_set_mempolicy_home_node },
+	[488] = { "faccessat", 9, __NR_faccessat },
+	[489] = { "munlockall", 10, __NR_munlockall },
+	[491] = { "shmdt", 5, __NR_shmdt },
+	[492] = { "set_robust_list", 15, __NR_set_robust_list },
+	[493] = { "recvmmsg", 8, __NR_recvmmsg },
+	[494] = { "rt_sigqueueinfo", 15, __NR_rt_sigqueueinfo },
+	[496] = { "query_module", 12, __NR_query_module },
+	[498] = { "copy_file_range", 15, __NR_copy_file_range },
+	[499] = { "pwritev2", 8, __NR_pwritev2 },
+	[501] = { "timer_create", 12, __NR_timer_create },
+	[502] = { "rename", 6, __NR_rename },
+	[503] = { "name_to_handle_at", 17, __NR_name_to_handle_at },
+	[504] = { "setresgid", 9, __NR_setresgid },
+	[505] = { "sethostname", 11, __NR_sethostname },
+	[507] = { "msgget", 6, __NR_msgget },
+	[508] = { "sync_file_range", 15, __NR_sync_file_range },
+	[509] = { "newfstatat", 10, __NR_newfstatat },
+	[511] = { "epoll_ctl", 9, __NR_epoll_ctl },
+};
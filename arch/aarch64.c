@@ -143,6 +143,146 @@ system_call_6(long n, long _1, long _2, long _3, long _4, long _5, long _6)
 	return x0;
 }
 
+/**
+ *
+ * callee-saved registers: x19 ~ x28 x29
+ *
+ * Values held only in these registers would be invisible
+ * to the garbage collector's scan of the stack, so they are
+ * copied out into a buffer that the caller keeps on the stack.
+ *
+ **/
+#define CALLEE_SAVED_REGISTERS 11
+
+static void
+save_callee_saved_registers(long registers[CALLEE_SAVED_REGISTERS])
+{
+	__asm__ volatile
+	("stp x19, x20, [%0, #0]"        "\n"
+	 "stp x21, x22, [%0, #16]"       "\n"
+	 "stp x23, x24, [%0, #32]"       "\n"
+	 "stp x25, x26, [%0, #48]"       "\n"
+	 "stp x27, x28, [%0, #64]"       "\n"
+	 "str x29,      [%0, #80]"       "\n"
+
+		:
+		: "r" (registers)
+		: "memory");
+}
+
+/**
+ *
+ * memory:          ldp and stp move 16 bytes per instruction pair
+ *
+ * Unaligned accesses to normal memory are allowed so there is
+ * no alignment handling. Backwards moves are only needed when
+ * the regions overlap with the destination ahead, which is rare.
+ *
+ **/
+static void
+memory_copy(void *to, const void *from, size_t count)
+{
+	unsigned char *destination = to;
+	const unsigned char *source = from;
+
+	for (/* count */; count >= 16; count -= 16) {
+		__asm__ volatile
+		("ldp x9, x10, [%1], #16"        "\n"
+		 "stp x9, x10, [%0], #16"        "\n"
+
+			: "+r" (destination), "+r" (source)
+			:
+			: "x9", "x10", "memory");
+	}
+
+	while (count--) { *destination++ = *source++; }
+}
+
+static void
+memory_move(void *to, const void *from, size_t count)
+{
+	unsigned char *destination = to;
+	const unsigned char *source = from;
+
+	if (destination <= source || destination >= source + count) {
+		memory_copy(to, from, count);
+		return;
+	}
+
+	destination += count;
+	source += count;
+
+	for (/* count */; count >= 16; count -= 16) {
+		__asm__ volatile
+		("ldp x9, x10, [%1, #-16]!"      "\n"
+		 "stp x9, x10, [%0, #-16]!"      "\n"
+
+			: "+r" (destination), "+r" (source)
+			:
+			: "x9", "x10", "memory");
+	}
+
+	while (count--) { *--destination = *--source; }
+}
+
+static void
+memory_fill(void *to, unsigned char byte, size_t count)
+{
+	unsigned char *destination = to;
+	unsigned long pattern = byte * 0x0101010101010101UL;
+
+	for (/* count */; count >= 16; count -= 16) {
+		__asm__ volatile
+		("stp %1, %1, [%0], #16"         "\n"
+
+			: "+r" (destination)
+			: "r" (pattern)
+			: "memory");
+	}
+
+	while (count--) { *destination++ = byte; }
+}
+
+static int
+memory_compare(const void *x, const void *y, size_t count)
+{
+	typedef unsigned long __attribute__((may_alias, aligned(1))) word;
+	const unsigned char *a = x, *b = y;
+
+	/* the compiler pairs these loads into ldp */
+	for (/* count */; count >= 16; count -= 16, a += 16, b += 16) {
+		if (((const word *) a)[0] != ((const word *) b)[0] ||
+		    ((const word *) a)[1] != ((const word *) b)[1]) { break; }
+	}
+
+	for (/* count */; count > 0; --count, ++a, ++b) {
+		if (*a != *b) { return *a - *b; }
+	}
+
+	return 0;
+}
+
+/**
+ *
+ * ticks:           cntvct_el0 virtual counter
+ *
+ * Counts at the constant system counter frequency given by
+ * cntfrq_el0 and is readable from user space on Linux.
+ *
+ **/
+static unsigned long
+clock_ticks(void)
+{
+	unsigned long ticks;
+
+	__asm__ volatile
+	("mrs %0, cntvct_el0"
+
+		: "=r" (ticks));
+
+	return ticks;
+}
+
 /**
  *
  * initial stack layout - logical
@@ -140,6 +140,128 @@ long system_call_6(long number, long _1, long _2, long _3, long _4, long _5, lon
 	return rax;
 }
 
+/**
+ *
+ * callee-saved registers: rbx rbp r12 r13 r14 r15
+ *
+ * Values held only in these registers would be invisible
+ * to the garbage collector's scan of the stack, so they are
+ * copied out into a buffer that the caller keeps on the stack.
+ *
+ **/
+#define CALLEE_SAVED_REGISTERS 6
+
+void save_callee_saved_registers(long registers[CALLEE_SAVED_REGISTERS])
+{
+	__asm__ volatile
+	("mov %%rbx,  0(%0)"             "\n"
+	 "mov %%rbp,  8(%0)"             "\n"
+	 "mov %%r12, 16(%0)"             "\n"
+	 "mov %%r13, 24(%0)"             "\n"
+	 "mov %%r14, 32(%0)"             "\n"
+	 "mov %%r15, 40(%0)"             "\n"
+
+		:
+		: "r" (registers)
+		: "memory");
+}
+
+/**
+ *
+ * memory:          rep movsb copies, rep stosb fills, SSE2 compares
+ *
+ * String instructions move whole cache lines at a time on
+ * processors with fast string support and need no alignment
+ * handling. Backwards moves are only needed when the regions
+ * overlap with the destination ahead, which is rare.
+ *
+ **/
+void memory_copy(void *to, const void *from, size_t count)
+{
+	__asm__ volatile
+	("rep movsb"
+
+		: "+D" (to), "+S" (from), "+c" (count)
+		:
+		: "memory");
+}
+
+void memory_move(void *to, const void *from, size_t count)
+{
+	unsigned char *destination = to;
+	const unsigned char *source = from;
+
+	if (destination <= source || destination >= source + count) {
+		memory_copy(to, from, count);
+		return;
+	}
+
+	destination += count - 1;
+	source += count - 1;
+
+	__asm__ volatile
+	("std"                           "\n"
+	 "rep movsb"                     "\n"
+	 "cld"                           "\n"
+
+		: "+D" (destination), "+S" (source), "+c" (count)
+		:
+		: "memory");
+}
+
+void memory_fill(void *to, unsigned char byte, size_t count)
+{
+	__asm__ volatile
+	("rep stosb"
+
+		: "+D" (to), "+c" (count)
+		: "a" (byte)
+		: "memory");
+}
+
+int memory_compare(const void *x, const void *y, size_t count)
+{
+	const unsigned char *a = x, *b = y;
+	size_t i = 0;
+	int equal;
+
+	for (/* i */; i + 16 <= count; i += 16) {
+		equal = __builtin_ia32_pmovmskb128(__builtin_ia32_pcmpeqb128(__builtin_ia32_loaddqu((const char *) a + i),
+		                                                             __builtin_ia32_loaddqu((const char *) b + i)));
+		if (equal != 0xFFFF) {
+			i += __builtin_ctz(~equal);
+			return a[i] - b[i];
+		}
+	}
+
+	for (/* i */; i < count; ++i) {
+		if (a[i] != b[i]) { return a[i] - b[i]; }
+	}
+
+	return 0;
+}
+
+/**
+ *
+ * ticks:           rdtsc time stamp counter
+ *
+ * Counts at a constant rate on modern processors, independent
+ * of frequency scaling. It is read without serializing since
+ * profiling only needs totals over many intervals.
+ *
+ **/
+unsigned long clock_ticks(void)
+{
+	unsigned int low, high;
+
+	__asm__ volatile
+	("rdtsc"
+
+		: "=a" (low), "=d" (high));
+
+	return ((unsigned long) high << 32) | low;
+}
+
 /**
  *
  * initial stack layout - logical
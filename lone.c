@@ -8,6 +8,11 @@
 #include <linux/types.h>
 #include <linux/unistd.h>
 #include <linux/auxvec.h>
+#include <linux/mman.h>
+#include <linux/fs.h>
+#include <linux/fcntl.h>
+#include <linux/uio.h>
+#include <linux/io_uring.h>
 
 typedef __kernel_size_t size_t;
 typedef __kernel_ssize_t ssize_t;
@@ -25,9 +30,50 @@ static ssize_t __attribute__((fd_arg_read(1), tainted_args)) linux_read(int fd,
 	return system_call_3(__NR_read, fd, (long) buffer, (long) count);
 }
 
-static ssize_t __attribute__((fd_arg_write(1), tainted_args)) linux_write(int fd, const void *buffer, size_t count)
+static ssize_t linux_writev(int fd, const struct iovec *vectors, int count)
 {
-	return system_call_3(__NR_write, fd, (long) buffer, (long) count);
+	return system_call_3(__NR_writev, fd, (long) vectors, count);
+}
+
+static void *linux_mmap(void *address, size_t length, int protection, int flags, int fd, long offset)
+{
+	return (void *) system_call_6(__NR_mmap, (long) address, (long) length, protection, flags, fd, offset);
+}
+
+static int linux_munmap(void *address, size_t length)
+{
+	return system_call_2(__NR_munmap, (long) address, (long) length);
+}
+
+static int linux_open(const char *path, int flags, int mode)
+{
+	return system_call_4(__NR_openat, AT_FDCWD, (long) path, flags, mode);
+}
+
+static long linux_lseek(int fd, long offset, int whence)
+{
+	return system_call_3(__NR_lseek, fd, offset, whence);
+}
+
+static int linux_close(int fd)
+{
+	return system_call_1(__NR_close, fd);
+}
+
+static int linux_io_uring_setup(unsigned entries, struct io_uring_params *parameters)
+{
+	return system_call_2(__NR_io_uring_setup, entries, (long) parameters);
+}
+
+static int linux_io_uring_enter(int fd, unsigned submit, unsigned wait, unsigned flags)
+{
+	return system_call_6(__NR_io_uring_enter, fd, submit, wait, flags, 0, 0);
+}
+
+static inline int linux_is_error(long result)
+{
+	/* system calls return -errno on failure, the last 4095 values */
+	return (unsigned long) result > -4096UL;
 }
 
 /* ╭────────────────────────────────────────────────────────────────────────╮
@@ -38,15 +84,21 @@ static ssize_t __attribute__((fd_arg_write(1), tainted_args)) linux_write(int fd
    │    https://en.wikipedia.org/wiki/FNV_hash                              │
    │    https://datatracker.ietf.org/doc/draft-eastlake-fnv/                │
    │                                                                        │
+   │    golden ratio multiplier = floor(2^bits / φ)                         │
+   │                                                                        │
+   │    https://en.wikipedia.org/wiki/Hash_function#Fibonacci_hashing       │
+   │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
 #if __BITS_PER_LONG == 64
 	#define DECIMAL_DIGITS_PER_LONG 20
 	#define FNV_PRIME 0x00000100000001B3UL
 	#define FNV_OFFSET_BASIS 0xCBF29CE484222325UL
+	#define GOLDEN_RATIO_MULTIPLIER 0x9E3779B97F4A7C15UL
 #elif __BITS_PER_LONG == 32
 	#define DECIMAL_DIGITS_PER_LONG 10
 	#define FNV_PRIME 0x01000193UL
 	#define FNV_OFFSET_BASIS 0x811C9DC5
+	#define GOLDEN_RATIO_MULTIPLIER 0x9E3779B9UL
 #else
 	#error "Unsupported architecture"
 #endif
@@ -80,6 +132,7 @@ enum lone_type {
 	LONE_BYTES,
 	LONE_INTEGER,
 	LONE_POINTER,
+	LONE_READER,
 };
 
 struct lone_bytes {
@@ -90,6 +143,12 @@ struct lone_bytes {
 struct lone_list {
 	struct lone_value *first;
 	struct lone_value *rest;
+	struct {
+		struct lone_value *function; /* whose frames the address is valid in */
+		unsigned int version;        /* of the table whose entry is cached */
+		unsigned short depth;        /* number of parent frames to skip */
+		unsigned short slot;         /* index of the parameter or table entry */
+	} address;                           /* lexical address of the symbol in first */
 };
 
 struct lone_vector {
@@ -119,11 +178,12 @@ struct lone_function_flags {
 	unsigned char variable_arguments: 1;
 };
 
+struct lone_bytecode;
 struct lone_function {
 	struct lone_value *arguments;        /* the bindings */
 	struct lone_value *code;             /* the lambda */
 	struct lone_value *environment;      /* the closure */
-	struct lone_function_flags flags;    /* how to evaluate & apply */
+	struct lone_bytecode *bytecode;      /* the compiled code, if any */
 };
 
 struct lone_lisp;
@@ -132,20 +192,40 @@ typedef struct lone_value *(*lone_primitive)(struct lone_lisp *lone,
                                              struct lone_value *environment,
                                              struct lone_value *arguments);
 
+/* receives evaluated arguments in an array instead of a list */
+typedef struct lone_value *(*lone_primitive_fast)(struct lone_lisp *lone,
+                                                  struct lone_value *closure,
+                                                  struct lone_value *environment,
+                                                  size_t count,
+                                                  struct lone_value **arguments);
+
 struct lone_primitive {
 	struct lone_value *name;
-	lone_primitive function;
+	lone_primitive function;             /* null if the primitive only has a fast path */
+	lone_primitive_fast fast;            /* null if the primitive needs its arguments in a list */
 	struct lone_value *closure;
-	struct lone_function_flags flags;    /* primitives always accept variable arguments */
 };
 
 struct lone_module {
 	struct lone_value *name;
 	struct lone_value *environment;
+	struct lone_value *deferred;         /* primitives creating members on first import, if any */
 };
 
+struct lone_reader;
+
 struct lone_value {
 	enum lone_type type;
+	union {
+		unsigned int version;              /* of tables, changes when keys are added or removed */
+		struct lone_function_flags flags;  /* of functions and primitives: how to evaluate & apply */
+		unsigned char escaped;             /* of frames: may outlive their calls, never recycled */
+		unsigned char io_uring;            /* of pointers: points to a ring created by lone */
+		struct {                           /* of bytes, texts and symbols: */
+			unsigned char borrowed;        /* memory is not owned */
+			unsigned short system_call;    /* cached system call number plus one, never for bytes since they may change in place */
+		};
+	};
 	union {
 		struct lone_module module;
 		struct lone_function function;
@@ -153,32 +233,163 @@ struct lone_value {
 		struct lone_list list;
 		struct lone_vector vector;
 		struct lone_table table;
-		struct lone_bytes bytes;   /* also used by texts and symbols */
+		struct {
+			struct lone_bytes bytes;   /* also used by texts and symbols */
+			unsigned long hash;        /* cached, zero if not yet computed */
+			struct lone_value *owner;  /* of slices: the bytes whose memory is shared */
+		};
 		long integer;
 		void *pointer;
+		struct lone_reader *reader;
 	};
 };
 
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Integers are not allocated unless they are too large to fit in      │
+   │    a pointer with its lowest bit set. Pointers to values are always    │
+   │    aligned so that bit is otherwise clear. The type and integer        │
+   │    value of any value must be obtained via the functions below.        │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+#define LONE_FIXNUM_TAG 1UL
+
+static inline int lone_is_fixnum(struct lone_value *value)
+{
+	return (unsigned long) value & LONE_FIXNUM_TAG;
+}
+
+static inline enum lone_type lone_type_of(struct lone_value *value)
+{
+	return lone_is_fixnum(value)? LONE_INTEGER : value->type;
+}
+
+static inline long lone_integer_of(struct lone_value *value)
+{
+	return lone_is_fixnum(value)? (long) value >> 1 : value->integer;
+}
+
 /* ╭───────────────────────┨ LONE LISP INTERPRETER ┠────────────────────────╮
    │                                                                        │
    │    The lone lisp interpreter is composed of all internal state         │
    │    necessary to process useful programs. It includes memory,           │
    │    references to all allocated objects, a table of interned            │
    │    symbols, all the loaded modules and the top level null module.      │
+   │    It also knows where the native stack begins so that the             │
+   │    garbage collector can find the values referenced by C code.         │
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
+#define LONE_MEMORY_SIZE_CLASSES 21
+#define LONE_OUTPUT_BUFFER_SIZE 4096
+#define LONE_FRAME_POOL_ARGUMENTS 8
+#define LONE_FRAME_POOL_DEPTH 32
+
+enum lone_profile_metric {
+	LONE_PROFILE_TIME,
+	LONE_PROFILE_CALLS,
+	LONE_PROFILE_ALLOCATIONS,
+};
+
 struct lone_memory;
+struct lone_memory_free;
+struct lone_memory_region;
+struct lone_value_slab;
+
+/* one for each distinct path of calls, see the profiler */
+struct lone_profile {
+	struct lone_value *function;         /* function or primitive, null at the root */
+	struct lone_value *name;             /* of functions, found when reporting */
+	struct lone_profile *parent;
+	struct lone_profile *children;
+	struct lone_profile *sibling;
+	struct lone_profile *next;           /* in the list of all profiles */
+	unsigned long calls;
+	unsigned long ticks;
+	unsigned long bytes;
+};
+
 struct lone_lisp {
-	struct lone_memory *memory;
-	struct lone_value_container *values;
+	struct {
+		struct lone_memory *blocks;
+		struct lone_memory_region *regions;
+		struct lone_memory_free *free[LONE_MEMORY_SIZE_CLASSES];
+		struct {
+			unsigned char *current;
+			unsigned char *end;
+		} bump;
+		struct {
+			unsigned char *pointer;
+			size_t size;
+		} initial;                /* given to lone when it starts */
+	} memory;
+	struct {
+		struct lone_value_slab *slabs;
+		struct lone_memory_free *free;
+		struct {
+			unsigned char **starts;
+			size_t count;
+			size_t capacity;
+		} batches;
+	} values;
+	struct {
+		size_t allocated;
+		size_t threshold;
+		size_t old;
+		size_t limit;
+		struct {
+			struct lone_value **values;
+			size_t count;
+			size_t capacity;
+		} stack;
+		struct {
+			unsigned long collections;
+			unsigned long major;  /* collections */
+			unsigned long freed;  /* values, by the last collection */
+			unsigned long ticks;  /* paused by the last collection */
+			unsigned long total;  /* ticks paused by all collections */
+		} statistics;
+		int log;                  /* collections to standard error */
+	} collector;
+	void *native_stack;
 	struct lone_value *symbol_table;
+	struct lone_value *nil;
+	struct {
+		struct lone_value *environment;
+	} tail;
+	struct {
+		struct lone_value *free[LONE_FRAME_POOL_ARGUMENTS];  /* by argument count */
+		size_t count[LONE_FRAME_POOL_ARGUMENTS];
+	} frames;
+	struct {
+		int file_descriptor;
+		size_t count;
+		unsigned char *buffer;
+	} output;
 	struct {
 		struct lone_value *loaded;
 		struct lone_value *null;
 		struct lone_value *import;
 	} modules;
+	struct {
+		int enabled;
+		enum lone_profile_metric metric;
+		unsigned long last;              /* ticks when the current profile was last charged */
+		struct lone_profile *root;
+		struct lone_profile *current;
+		struct lone_profile *all;
+		size_t count;
+	} profiler;
 };
 
+static void lone_output_flush(struct lone_lisp *lone);
+
+/* errors end the program but what was printed before them must still be written out */
+static void __attribute__((noreturn)) lone_exit(struct lone_lisp *lone, int code)
+{
+	lone_output_flush(lone);
+	linux_exit(code);
+}
+
 /* ╭────────────────────┨ LONE LISP MEMORY ALLOCATION ┠─────────────────────╮
    │                                                                        │
    │    Lone is designed to work without any dependencies except Linux,     │
@@ -191,7 +402,32 @@ struct lone_lisp {
    │    They will be split into smaller units when allocated                │
    │    and merged together with free neighbors when deallocated.           │
    │                                                                        │
+   │    Small allocations are segregated into fixed size classes:           │
+   │    multiples of 8 bytes up to 128 bytes and powers of two up to        │
+   │    4 KiB. Each class has its own list of free blocks.                  │
+   │    New small blocks are carved out of large chunks of memory           │
+   │    with a bump pointer. Deallocated small blocks are returned          │
+   │    to the free list of their class. Both operations are O(1).          │
+   │                                                                        │
+   │    Small blocks are preceded only by their size, which is also         │
+   │    the last field of a large block's header. This allows telling       │
+   │    them apart on deallocation since large blocks are bigger.           │
+   │                                                                        │
+   │    When no block is big enough, more memory is requested from          │
+   │    the kernel via mmap. The new region becomes a free block            │
+   │    in the block list. Only neighbors which are also adjacent           │
+   │    in memory are merged, so blocks never span multiple regions.        │
+   │    Regions which become entirely free are returned via munmap.         │
+   │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
+#define LONE_MEMORY_ALIGNMENT 16
+#define LONE_MEMORY_SMALL_GRANULARITY 8
+#define LONE_MEMORY_SMALL_LINEAR_LIMIT 128
+#define LONE_MEMORY_SMALL_LIMIT 4096
+#define LONE_MEMORY_CHUNK_SIZE (64 * 1024)
+#define LONE_MEMORY_REGION_SIZE (1024 * 1024)
+#define LONE_MEMORY_PAGE_SIZE 4096
+
 struct lone_memory {
 	struct lone_memory *prev, *next;
 	int free;
@@ -199,28 +435,61 @@ struct lone_memory {
 	unsigned char pointer[];
 };
 
-struct lone_value_header {
-	struct lone_value_container *next;
-	unsigned char marked;
+struct lone_memory_small {
+	size_t size;
+	unsigned char pointer[];
+};
+
+struct lone_memory_free {
+	struct lone_memory_free *next;
+};
+
+struct lone_memory_region {
+	struct lone_memory_region *next;
+	size_t size;
 };
 
-struct lone_value_container {
-	struct lone_value_header header;
-	struct lone_value value;
+_Static_assert(__builtin_offsetof(struct lone_memory, pointer) - __builtin_offsetof(struct lone_memory, size) == sizeof(size_t),
+               "size must immediately precede the pointer in large and small blocks alike");
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Values are allocated from page-sized slabs of same-size slots       │
+   │    instead of individual memory blocks. The slabs are aligned          │
+   │    to their size so that any value's slab can be found by masking      │
+   │    its address. Each slab tracks which of its slots are allocated      │
+   │    and which of them were marked by the garbage collector in           │
+   │    contiguous bitmaps. Free slots are linked into a single list.       │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+#define LONE_VALUE_SLAB_SIZE LONE_MEMORY_PAGE_SIZE
+#define LONE_VALUE_SLAB_BATCH 16
+#define LONE_COLLECTOR_MINIMUM_THRESHOLD 16384
+#define LONE_VALUE_SLAB_BITMAP_WORDS ((LONE_VALUE_SLAB_SIZE / sizeof(struct lone_value) + __BITS_PER_LONG - 1) / __BITS_PER_LONG)
+#define LONE_VALUE_SLAB_SLOTS ((LONE_VALUE_SLAB_SIZE - sizeof(struct lone_value_slab)) / sizeof(struct lone_value))
+
+struct lone_value_slab {
+	struct lone_value_slab *next;
+	unsigned long allocated[LONE_VALUE_SLAB_BITMAP_WORDS];
+	unsigned long marked[LONE_VALUE_SLAB_BITMAP_WORDS];
+	unsigned long remembered[LONE_VALUE_SLAB_BITMAP_WORDS];
+	struct lone_value values[];
 };
 
+/* bulk memory operations are implemented by architecture-specific code */
 static void lone_memory_move(void *from, void *to, size_t count)
 {
-	unsigned char *source = from, *destination = to;
+	memory_move(to, from, count);
+}
 
-	if (source >= destination) {
-		/* destination is at or behind source, copy forwards */
-		while (count--) { *destination++ = *source++; }
-	} else {
-		/* destination is ahead of source, copy backwards */
-		source += count; destination += count;
-		while (count--) { *--destination = *--source; }
-	}
+static void lone_memory_zero(void *pointer, size_t count)
+{
+	memory_fill(pointer, 0, count);
+}
+
+static void lone_memory_fill(void *pointer, unsigned char byte, size_t count)
+{
+	memory_fill(pointer, byte, count);
 }
 
 static void lone_memory_split(struct lone_memory *block, size_t used)
@@ -239,164 +508,688 @@ static void lone_memory_split(struct lone_memory *block, size_t used)
 	}
 }
 
-static void lone_memory_coalesce(struct lone_memory *block)
+static inline int lone_memory_is_adjacent(struct lone_memory *block, struct lone_memory *next)
+{
+	return block->pointer + block->size == (unsigned char *) next;
+}
+
+static int lone_memory_coalesce(struct lone_memory *block)
 {
 	struct lone_memory *next;
 
 	if (block && block->free) {
 		next = block->next;
-		if (next && next->free) {
+		if (next && next->free && lone_memory_is_adjacent(block, next)) {
 			block->size += next->size + sizeof(struct lone_memory);
 			next = block->next = next->next;
 			if (next) { next->prev = block; }
+			return 1;
 		}
 	}
+
+	return 0;
 }
 
-static void * __attribute__((malloc, alloc_size(2))) lone_allocate(struct lone_lisp *lone, size_t requested_size)
+static inline struct lone_memory *lone_memory_region_block(struct lone_memory_region *region)
+{
+	return (struct lone_memory *) (region + 1);
+}
+
+static struct lone_memory *lone_memory_grow(struct lone_lisp *lone, size_t needed_size)
+{
+	size_t size = sizeof(struct lone_memory_region) + sizeof(struct lone_memory) + needed_size;
+	struct lone_memory_region *region;
+	struct lone_memory *block;
+
+	if (size < LONE_MEMORY_REGION_SIZE) { size = LONE_MEMORY_REGION_SIZE; }
+	size = (size + LONE_MEMORY_PAGE_SIZE - 1) & -LONE_MEMORY_PAGE_SIZE;
+
+	region = linux_mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (linux_is_error((long) region)) { return 0; }
+
+	region->size = size;
+	region->next = lone->memory.regions;
+	lone->memory.regions = region;
+
+	block = lone_memory_region_block(region);
+	block->free = 1;
+	block->size = size - sizeof(struct lone_memory_region) - sizeof(struct lone_memory);
+	block->prev = 0;
+	block->next = lone->memory.blocks;
+	if (block->next) { block->next->prev = block; }
+	lone->memory.blocks = block;
+
+	return block;
+}
+
+static void lone_memory_release(struct lone_lisp *lone, struct lone_memory *block)
+{
+	struct lone_memory_region **regions = &lone->memory.regions, *region;
+
+	for (/* regions */; (region = *regions); regions = &region->next) {
+		if (block != lone_memory_region_block(region)) { continue; }
+		if (block->size != region->size - sizeof(struct lone_memory_region) - sizeof(struct lone_memory)) { return; }
+
+		/* the whole region is free, give it back to the kernel */
+		if (block->prev) { block->prev->next = block->next; } else { lone->memory.blocks = block->next; }
+		if (block->next) { block->next->prev = block->prev; }
+		*regions = region->next;
+		linux_munmap(region, region->size);
+		return;
+	}
+}
+
+static inline size_t lone_memory_size_of(void *pointer)
+{
+	return ((size_t *) pointer)[-1];
+}
+
+static inline int lone_memory_is_small(size_t size)
+{
+	return size <= LONE_MEMORY_SMALL_LIMIT;
+}
+
+static inline size_t lone_memory_size_class(size_t size)
+{
+	if (size <= LONE_MEMORY_SMALL_LINEAR_LIMIT) {
+		return size? (size - 1) / LONE_MEMORY_SMALL_GRANULARITY : 0;
+	} else {
+		/* 129 ~ 256 → 16, 257 ~ 512 → 17, ..., 2049 ~ 4096 → 20 */
+		return 16 + (__BITS_PER_LONG - __builtin_clzl(size - 1)) - 8;
+	}
+}
+
+static inline size_t lone_memory_class_size(size_t class)
+{
+	if (class < 16) {
+		return (class + 1) * LONE_MEMORY_SMALL_GRANULARITY;
+	} else {
+		return 1UL << (class - 16 + 8);
+	}
+}
+
+static inline size_t lone_memory_class_stride(size_t class)
+{
+	return sizeof(struct lone_memory_small) + lone_memory_class_size(class);
+}
+
+static struct lone_memory *lone_memory_allocate_block(struct lone_lisp *lone, size_t requested_size)
 {
 	size_t needed_size = requested_size + sizeof(struct lone_memory);
 	struct lone_memory *block;
 
-	for (block = lone->memory; block; block = block->next) {
+	/* keeps all large blocks aligned */
+	needed_size = (needed_size + LONE_MEMORY_ALIGNMENT - 1) & -LONE_MEMORY_ALIGNMENT;
+
+	for (block = lone->memory.blocks; block; block = block->next) {
 		if (block->free && block->size >= needed_size)
 			break;
 	}
 
-	if (!block) { linux_exit(-1); }
+	if (!block) { block = lone_memory_grow(lone, needed_size); }
+	if (!block) { return 0; }
 
 	block->free = 0;
 	lone_memory_split(block, needed_size);
 
-	return block->pointer;
+	return block;
+}
+
+static void lone_memory_free_push(struct lone_lisp *lone, size_t class, void *pointer)
+{
+	struct lone_memory_free *free = pointer;
+	free->next = lone->memory.free[class];
+	lone->memory.free[class] = free;
+}
+
+static void lone_memory_bump_retire(struct lone_lisp *lone)
+{
+	unsigned char *current = lone->memory.bump.current, *end = lone->memory.bump.end;
+	struct lone_memory_small *small;
+	size_t remaining, class;
+
+	/* give whatever is left of the chunk to the free lists */
+	while ((remaining = end - current) > sizeof(struct lone_memory_small)) {
+		class = lone_memory_size_class(remaining - sizeof(struct lone_memory_small));
+		if (lone_memory_class_stride(class) > remaining) { --class; }
+		small = (struct lone_memory_small *) current;
+		small->size = lone_memory_class_size(class);
+		lone_memory_free_push(lone, class, small->pointer);
+		current += lone_memory_class_stride(class);
+	}
+
+	lone->memory.bump.current = lone->memory.bump.end = 0;
+}
+
+static int lone_memory_bump_refill(struct lone_lisp *lone, size_t minimum)
+{
+	struct lone_memory *chunk;
+
+	lone_memory_bump_retire(lone);
+
+	chunk = lone_memory_allocate_block(lone, LONE_MEMORY_CHUNK_SIZE);
+	if (!chunk) { chunk = lone_memory_allocate_block(lone, minimum); }
+	if (!chunk) { return 0; }
+
+	lone->memory.bump.current = chunk->pointer;
+	lone->memory.bump.end = chunk->pointer + chunk->size;
+	return 1;
+}
+
+static void *lone_memory_allocate_small(struct lone_lisp *lone, size_t requested_size)
+{
+	size_t class = lone_memory_size_class(requested_size), stride = lone_memory_class_stride(class);
+	struct lone_memory_free *free = lone->memory.free[class];
+	struct lone_memory_small *small;
+
+	if (free) {
+		lone->memory.free[class] = free->next;
+		return free;
+	}
+
+	if ((size_t) (lone->memory.bump.end - lone->memory.bump.current) < stride) {
+		if (!lone_memory_bump_refill(lone, stride)) { return 0; }
+	}
+
+	small = (struct lone_memory_small *) lone->memory.bump.current;
+	lone->memory.bump.current += stride;
+	small->size = lone_memory_class_size(class);
+
+	return small->pointer;
+}
+
+static void * __attribute__((malloc, alloc_size(2))) lone_allocate(struct lone_lisp *lone, size_t requested_size)
+{
+	struct lone_memory *block;
+	void *pointer;
+
+	if (lone->profiler.enabled) { lone->profiler.current->bytes += requested_size; }
+
+	if (lone_memory_is_small(requested_size)) {
+		pointer = lone_memory_allocate_small(lone, requested_size);
+	} else {
+		block = lone_memory_allocate_block(lone, requested_size);
+		pointer = block? block->pointer : 0;
+	}
+
+	if (!pointer) { lone_exit(lone, -1); }
+
+	return pointer;
 }
 
 static void lone_deallocate(struct lone_lisp *lone, void * pointer)
 {
-	struct lone_memory *block = ((struct lone_memory *) pointer) - 1;
+	size_t size = lone_memory_size_of(pointer);
+	struct lone_memory *block;
+
+	if (lone_memory_is_small(size)) {
+		lone_memory_free_push(lone, lone_memory_size_class(size), pointer);
+		return;
+	}
+
+	block = ((struct lone_memory *) pointer) - 1;
 	block->free = 1;
 
 	lone_memory_coalesce(block);
-	lone_memory_coalesce(block->prev);
+	if (lone_memory_coalesce(block->prev)) { block = block->prev; }
+
+	lone_memory_release(lone, block);
 }
 
 static void * __attribute__((alloc_size(3))) lone_reallocate(struct lone_lisp *lone, void *pointer, size_t size)
 {
-	struct lone_memory *old = ((struct lone_memory *) pointer) - 1,
-	                   *new = ((struct lone_memory *) lone_allocate(lone, size)) - 1;
+	size_t old_size = pointer? lone_memory_size_of(pointer) : 0;
+	void *new;
+
+	if (pointer && lone_memory_is_small(old_size) && lone_memory_is_small(size)
+	            && lone_memory_size_class(size) == lone_memory_size_class(old_size)) {
+		/* still fits in the same size class */
+		return pointer;
+	}
+
+	new = lone_allocate(lone, size);
 
 	if (pointer) {
-		lone_memory_move(old->pointer, new->pointer, new->size < old->size ? new->size : old->size);
+		lone_memory_move(pointer, new, size < old_size ? size : old_size);
 		lone_deallocate(lone, pointer);
 	}
 
-	return new->pointer;
+	return new;
+}
+
+static inline struct lone_value_slab *lone_value_to_slab(struct lone_value *value)
+{
+	return (struct lone_value_slab *) ((unsigned long) value & -LONE_VALUE_SLAB_SIZE);
+}
+
+static inline size_t lone_value_slab_index(struct lone_value_slab *slab, struct lone_value *value)
+{
+	return value - slab->values;
+}
+
+static inline int lone_bitmap_test(unsigned long *bitmap, size_t i)
+{
+	return (bitmap[i / __BITS_PER_LONG] >> (i % __BITS_PER_LONG)) & 1;
+}
+
+static inline void lone_bitmap_set(unsigned long *bitmap, size_t i)
+{
+	bitmap[i / __BITS_PER_LONG] |= 1UL << (i % __BITS_PER_LONG);
+}
+
+static inline size_t lone_bitmap_count(unsigned long word)
+{
+	/* __builtin_popcountl may need a compiler runtime function */
+	size_t count = 0;
+	while (word) { word &= word - 1; ++count; }
+	return count;
+}
+
+static void lone_value_batches_insert(struct lone_lisp *lone, unsigned char *batch)
+{
+	size_t i;
+
+	if (lone->values.batches.count >= lone->values.batches.capacity) {
+		lone->values.batches.capacity = lone->values.batches.capacity? lone->values.batches.capacity * 2 : 16;
+		lone->values.batches.starts = lone_reallocate(lone, lone->values.batches.starts,
+		                                              lone->values.batches.capacity * sizeof(*lone->values.batches.starts));
+	}
+
+	/* kept sorted by address for binary search */
+	for (i = lone->values.batches.count++; i > 0 && lone->values.batches.starts[i - 1] > batch; --i) {
+		lone->values.batches.starts[i] = lone->values.batches.starts[i - 1];
+	}
+
+	lone->values.batches.starts[i] = batch;
+}
+
+static void lone_value_slabs_grow(struct lone_lisp *lone)
+{
+	unsigned char *batch = lone_allocate(lone, (LONE_VALUE_SLAB_BATCH + 1) * LONE_VALUE_SLAB_SIZE);
+	struct lone_value_slab *slab;
+	struct lone_memory_free *free;
+	size_t i, j;
+
+	/* slabs must be aligned to their size, skip the unaligned start */
+	batch = (unsigned char *) (((unsigned long) batch + LONE_VALUE_SLAB_SIZE - 1) & -LONE_VALUE_SLAB_SIZE);
+	lone_value_batches_insert(lone, batch);
+
+	for (i = 0; i < LONE_VALUE_SLAB_BATCH; ++i) {
+		slab = (struct lone_value_slab *) (batch + i * LONE_VALUE_SLAB_SIZE);
+
+		for (j = 0; j < LONE_VALUE_SLAB_BITMAP_WORDS; ++j) {
+			slab->allocated[j] = 0;
+			slab->marked[j] = 0;
+			slab->remembered[j] = 0;
+		}
+
+		for (j = LONE_VALUE_SLAB_SLOTS; j--; /* in reverse so that slots are handed out in order */) {
+			free = (struct lone_memory_free *) &slab->values[j];
+			free->next = lone->values.free;
+			lone->values.free = free;
+		}
+
+		slab->next = lone->values.slabs;
+		lone->values.slabs = slab;
+	}
 }
 
-static inline struct lone_value_container *lone_value_to_container(struct lone_value* value)
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Marking is driven by an explicit stack of values whose              │
+   │    references still need to be followed, so that the depth of          │
+   │    the native stack does not depend on the shape of the data.          │
+   │    Values are marked as they are pushed, each one at most once.        │
+   │    The rest of a list is followed in a loop without pushing it         │
+   │    and all elements of vectors and tables are pushed at once.          │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static int lone_mark(struct lone_value *value)
 {
-	if (!value) { return 0; }
-	unsigned char *bytes = (unsigned char *) value;
-	bytes -= __builtin_offsetof(struct lone_value_container, value);
-	return (struct lone_value_container *) bytes;
+	struct lone_value_slab *slab;
+	size_t i;
+
+	if (!value || lone_is_fixnum(value)) { return 0; }
+
+	slab = lone_value_to_slab(value);
+	i = lone_value_slab_index(slab, value);
+
+	if (lone_bitmap_test(slab->marked, i)) { return 0; }
+
+	lone_bitmap_set(slab->marked, i);
+	return 1;
 }
 
-static void lone_mark_value(struct lone_value *value)
+static void lone_mark_stack_reserve(struct lone_lisp *lone, size_t count)
 {
-	struct lone_value_container *container = lone_value_to_container(value);
+	size_t needed = lone->collector.stack.count + count, capacity = lone->collector.stack.capacity;
+
+	if (needed <= capacity) { return; }
 
-	if (!container || container->header.marked == 1) { return; }
+	if (!capacity) { capacity = 256; }
+	while (capacity < needed) { capacity *= 2; }
+
+	lone->collector.stack.values = lone_reallocate(lone, lone->collector.stack.values,
+	                                               capacity * sizeof(*lone->collector.stack.values));
+	lone->collector.stack.capacity = capacity;
+}
+
+static inline void lone_mark_push(struct lone_lisp *lone, struct lone_value *value)
+{
+	/* space must have been reserved */
+	if (lone_mark(value)) {
+		lone->collector.stack.values[lone->collector.stack.count++] = value;
+	}
+}
 
-	container->header.marked = 1;
+static void lone_mark_references(struct lone_lisp *lone, struct lone_value *value)
+{
+	struct lone_value *rest;
+	size_t i;
 
-	switch (container->value.type) {
+	switch (value->type) {
 	case LONE_MODULE:
-		lone_mark_value(container->value.module.name);
-		lone_mark_value(container->value.module.environment);
+		lone_mark_stack_reserve(lone, 3);
+		lone_mark_push(lone, value->module.name);
+		lone_mark_push(lone, value->module.environment);
+		lone_mark_push(lone, value->module.deferred);
 		break;
 	case LONE_FUNCTION:
-		lone_mark_value(container->value.function.arguments);
-		lone_mark_value(container->value.function.code);
-		lone_mark_value(container->value.function.environment);
+		lone_mark_stack_reserve(lone, 3);
+		lone_mark_push(lone, value->function.arguments);
+		lone_mark_push(lone, value->function.code);
+		lone_mark_push(lone, value->function.environment);
 		break;
 	case LONE_PRIMITIVE:
-		lone_mark_value(container->value.primitive.closure);
+		lone_mark_stack_reserve(lone, 1);
+		lone_mark_push(lone, value->primitive.closure);
 		break;
 	case LONE_LIST:
-		lone_mark_value(container->value.list.first);
-		lone_mark_value(container->value.list.rest);
+		while (1) {
+			lone_mark_stack_reserve(lone, 3);
+			lone_mark_push(lone, value->list.first);
+			lone_mark_push(lone, value->list.address.function);
+			rest = value->list.rest;
+
+			if (!rest || lone_type_of(rest) != LONE_LIST) { lone_mark_push(lone, rest); break; }
+			if (!lone_mark(rest)) { break; }
+
+			value = rest;
+		}
 		break;
 	case LONE_VECTOR:
-		for (size_t i = 0; i < container->value.vector.count; ++i) {
-			lone_mark_value(container->value.vector.values[i]);
+		lone_mark_stack_reserve(lone, value->vector.count);
+		for (i = 0; i < value->vector.count; ++i) {
+			lone_mark_push(lone, value->vector.values[i]);
 		}
 		break;
 	case LONE_TABLE:
-		lone_mark_value(container->value.table.prototype);
-		for (size_t i = 0; i < container->value.table.capacity; ++i) {
-			lone_mark_value(container->value.table.entries[i].key);
-			lone_mark_value(container->value.table.entries[i].value);
+		lone_mark_stack_reserve(lone, 1 + 2 * value->table.capacity);
+		lone_mark_push(lone, value->table.prototype);
+		for (i = 0; i < value->table.capacity; ++i) {
+			lone_mark_push(lone, value->table.entries[i].key);
+			lone_mark_push(lone, value->table.entries[i].value);
 		}
 		break;
+	case LONE_BYTES:
+		/* slices keep the memory they share alive */
+		if (value->owner) { lone_mark_push(lone, value->owner); }
+		break;
 	case LONE_SYMBOL:
 	case LONE_TEXT:
-	case LONE_BYTES:
 	case LONE_POINTER:
+	case LONE_READER:
 	case LONE_INTEGER:
 		/* these types do not contain any other values to mark */
 		break;
 	}
 }
 
-static void lone_mark_all_reachable_values(struct lone_lisp *lone)
+static void lone_mark_drain(struct lone_lisp *lone)
 {
-	lone_mark_value(lone->symbol_table);
-	lone_mark_value(lone->modules.loaded);
-	lone_mark_value(lone->modules.null);
-	lone_mark_value(lone->modules.import);
+	while (lone->collector.stack.count) {
+		lone_mark_references(lone, lone->collector.stack.values[--lone->collector.stack.count]);
+	}
 }
 
-static void lone_deallocate_all_unmarked_values(struct lone_lisp *lone)
+static void lone_mark_value(struct lone_lisp *lone, struct lone_value *value)
 {
-	struct lone_value_container **values = &lone->values, *value;
-	while ((value = *values)) {
-		if (value->header.marked) {
-			value->header.marked = 0;
-			values = &value->header.next;
-		} else {
-			*values = value->header.next;
+	lone_mark_stack_reserve(lone, 1);
+	lone_mark_push(lone, value);
+	lone_mark_drain(lone);
+}
 
-			switch (value->value.type) {
-			case LONE_BYTES:
-			case LONE_TEXT:
-			case LONE_SYMBOL:
-				lone_deallocate(lone, value->value.bytes.pointer);
-				break;
-			case LONE_VECTOR:
-				lone_deallocate(lone, value->value.vector.values);
-				break;
-			case LONE_TABLE:
-				lone_deallocate(lone, value->value.table.entries);
-				break;
-			case LONE_MODULE:
-			case LONE_FUNCTION:
-			case LONE_PRIMITIVE:
-			case LONE_LIST:
-			case LONE_INTEGER:
-			case LONE_POINTER:
-				/* these types do not own any additional memory */
-				break;
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    The garbage collector may run during evaluation, whenever           │
+   │    enough values have been allocated since the last collection.        │
+   │    At that point, C code all over the evaluator and primitives         │
+   │    holds references to values in its local variables.                  │
+   │                                                                        │
+   │    Instead of requiring every one of those locals to be registered,    │
+   │    the collector treats the native stack and the callee-saved          │
+   │    registers as roots. It scans every word between the current         │
+   │    stack frame and the start of the stack and marks any word           │
+   │    that points into an allocated slot of a value slab. This is         │
+   │    conservative: an integer which happens to look like a pointer       │
+   │    keeps a value alive. Values are never moved so it is correct.       │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static struct lone_value *lone_value_find(struct lone_lisp *lone, unsigned long word)
+{
+	unsigned char **starts = lone->values.batches.starts, *pointer = (unsigned char *) word;
+	size_t low = 0, high = lone->values.batches.count, middle, i;
+	struct lone_value_slab *slab;
+
+	if (high == 0 || pointer < starts[0]) { return 0; }
+
+	/* find the last batch starting at or before the pointer */
+	while (high - low > 1) {
+		middle = low + (high - low) / 2;
+		if (starts[middle] <= pointer) { low = middle; } else { high = middle; }
+	}
+
+	if (pointer >= starts[low] + LONE_VALUE_SLAB_BATCH * LONE_VALUE_SLAB_SIZE) { return 0; }
+
+	slab = (struct lone_value_slab *) ((unsigned long) pointer & -LONE_VALUE_SLAB_SIZE);
+	if (pointer < (unsigned char *) slab->values) { return 0; }
+
+	i = ((unsigned long) pointer - (unsigned long) slab->values) / sizeof(struct lone_value);
+	if (i >= LONE_VALUE_SLAB_SLOTS || !lone_bitmap_test(slab->allocated, i)) { return 0; }
+
+	return &slab->values[i];
+}
+
+static void __attribute__((noinline)) lone_mark_native_stack(struct lone_lisp *lone)
+{
+	unsigned long *word = __builtin_frame_address(0), *end = lone->native_stack;
+
+	for (/* word */; word < end; ++word) {
+		lone_mark_value(lone, lone_value_find(lone, *word));
+	}
+}
+
+static void lone_mark_native_roots(struct lone_lisp *lone)
+{
+	long registers[CALLEE_SAVED_REGISTERS];
+
+	/* spills registers into this frame, which is above the scanned one */
+	save_callee_saved_registers(registers);
+	lone_mark_native_stack(lone);
+	__asm__ volatile ("" : : "r" (registers) : "memory");
+}
+
+static void lone_mark_profiles(struct lone_lisp *);
+
+static void lone_mark_all_reachable_values(struct lone_lisp *lone)
+{
+	size_t i;
+
+	lone_mark_value(lone, lone->symbol_table);
+	lone_mark_value(lone, lone->nil);
+	lone_mark_value(lone, lone->tail.environment);
+	for (i = 0; i < LONE_FRAME_POOL_ARGUMENTS; ++i) { lone_mark_value(lone, lone->frames.free[i]); }
+	lone_mark_value(lone, lone->modules.loaded);
+	lone_mark_value(lone, lone->modules.null);
+	lone_mark_value(lone, lone->modules.import);
+	lone_mark_profiles(lone);
+	lone_mark_native_roots(lone);
+}
+
+static void lone_reader_finalize(struct lone_lisp *, struct lone_reader *);
+
+static void lone_deallocate_value(struct lone_lisp *lone, struct lone_value *value)
+{
+	struct lone_memory_free *free;
+
+	switch (value->type) {
+	case LONE_BYTES:
+	case LONE_TEXT:
+	case LONE_SYMBOL:
+		if (!value->borrowed) { lone_deallocate(lone, value->bytes.pointer); }
+		break;
+	case LONE_VECTOR:
+		lone_deallocate(lone, value->vector.values);
+		break;
+	case LONE_TABLE:
+		lone_deallocate(lone, value->table.entries);
+		break;
+	case LONE_FUNCTION:
+		if (value->function.bytecode) { lone_deallocate(lone, value->function.bytecode); }
+		break;
+	case LONE_READER:
+		lone_reader_finalize(lone, value->reader);
+		break;
+	case LONE_MODULE:
+	case LONE_PRIMITIVE:
+	case LONE_LIST:
+	case LONE_INTEGER:
+	case LONE_POINTER:
+		/* these types do not own any additional memory */
+		break;
+	}
+
+	free = (struct lone_memory_free *) value;
+	free->next = lone->values.free;
+	lone->values.free = free;
+}
+
+static size_t lone_deallocate_all_unmarked_values(struct lone_lisp *lone)
+{
+	struct lone_value_slab *slab;
+	unsigned long dead;
+	size_t i, bit, live = 0;
+
+	lone->collector.statistics.freed = 0;
+
+	for (slab = lone->values.slabs; slab; slab = slab->next) {
+		for (i = 0; i < LONE_VALUE_SLAB_BITMAP_WORDS; ++i) {
+			dead = slab->allocated[i] & ~slab->marked[i];
+			lone->collector.statistics.freed += lone_bitmap_count(dead);
+
+			while (dead) {
+				bit = __builtin_ctzl(dead);
+				lone_deallocate_value(lone, &slab->values[i * __BITS_PER_LONG + bit]);
+				dead &= dead - 1;
+			}
+
+			/* marks are kept: surviving values become old */
+			live += lone_bitmap_count(slab->marked[i]);
+			slab->allocated[i] = slab->marked[i];
+			slab->remembered[i] = 0;
+		}
+	}
+
+	return live;
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    The collector is generational. Mark bits are not cleared after      │
+   │    a collection: values which survived one are old and stay marked.    │
+   │    A minor collection marks only the young values created since        │
+   │    the previous collection because marking stops at old values.        │
+   │    The roots and the module environments are old and are skipped.      │
+   │                                                                        │
+   │    Old values which are made to reference other values are found       │
+   │    in the remembered bitmaps maintained by the write barrier and       │
+   │    their references are followed as if they were roots.                │
+   │                                                                        │
+   │    Dead old values are only found by major collections which clear     │
+   │    all marks first. One is done whenever the old generation has        │
+   │    grown to twice the size of the live data after the last one.        │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static inline void lone_write_barrier(struct lone_value *value)
+{
+	struct lone_value_slab *slab = lone_value_to_slab(value);
+	size_t i = lone_value_slab_index(slab, value);
+	if (lone_bitmap_test(slab->marked, i)) { lone_bitmap_set(slab->remembered, i); }
+}
+
+static void lone_mark_remembered_values(struct lone_lisp *lone)
+{
+	struct lone_value_slab *slab;
+	unsigned long remembered;
+	size_t i, bit;
+
+	for (slab = lone->values.slabs; slab; slab = slab->next) {
+		for (i = 0; i < LONE_VALUE_SLAB_BITMAP_WORDS; ++i) {
+			remembered = slab->remembered[i];
+
+			while (remembered) {
+				bit = __builtin_ctzl(remembered);
+				lone_mark_references(lone, &slab->values[i * __BITS_PER_LONG + bit]);
+				lone_mark_drain(lone);
+				remembered &= remembered - 1;
 			}
+		}
+	}
+}
 
-			lone_deallocate(lone, value);
+static void lone_unmark_all_values(struct lone_lisp *lone)
+{
+	struct lone_value_slab *slab;
+	size_t i;
+
+	for (slab = lone->values.slabs; slab; slab = slab->next) {
+		for (i = 0; i < LONE_VALUE_SLAB_BITMAP_WORDS; ++i) {
+			slab->marked[i] = 0;
+			slab->remembered[i] = 0;
 		}
 	}
 }
 
-static void lone_garbage_collector(struct lone_lisp *lone)
+static void lone_garbage_collector_log(struct lone_lisp *, int);
+
+/* callers must not keep values in registers which only the collector preserves,
+   where the native roots would not find them: treat it as an opaque function */
+static void __attribute__((noipa)) lone_garbage_collector(struct lone_lisp *lone)
 {
+	int major = lone->collector.old >= lone->collector.limit;
+	unsigned long start = clock_ticks();
+
+	if (major) {
+		lone_unmark_all_values(lone);
+	} else {
+		lone_mark_remembered_values(lone);
+	}
+
 	lone_mark_all_reachable_values(lone);
-	lone_deallocate_all_unmarked_values(lone);
+	lone->collector.old = lone_deallocate_all_unmarked_values(lone);
+	lone->collector.allocated = 0;
+
+	if (major) {
+		lone->collector.limit = lone->collector.old > LONE_COLLECTOR_MINIMUM_THRESHOLD / 2?
+		                        lone->collector.old * 2 : LONE_COLLECTOR_MINIMUM_THRESHOLD;
+	}
+
+	++lone->collector.statistics.collections;
+	if (major) { ++lone->collector.statistics.major; }
+	lone->collector.statistics.ticks = clock_ticks() - start;
+	lone->collector.statistics.total += lone->collector.statistics.ticks;
+
+	if (lone->collector.log) { lone_garbage_collector_log(lone, major); }
 }
 
 /* ╭────────────────────────────────────────────────────────────────────────╮
@@ -405,42 +1198,101 @@ static void lone_garbage_collector(struct lone_lisp *lone)
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
 static struct lone_value *lone_module_create(struct lone_lisp *, struct lone_value *);
+static struct lone_value *lone_list_create(struct lone_lisp *, struct lone_value *, struct lone_value *);
 static struct lone_value *lone_primitive_create(struct lone_lisp *, char *, lone_primitive, struct lone_value *, struct lone_function_flags);
 static struct lone_value *lone_primitive_import(struct lone_lisp *, struct lone_value *, struct lone_value *, struct lone_value *);
 static struct lone_value *lone_table_create(struct lone_lisp *, size_t, struct lone_value *);
 static void lone_table_set(struct lone_lisp *, struct lone_value *, struct lone_value *, struct lone_value *);
 
-static void lone_lisp_initialize(struct lone_lisp *lone, unsigned char *memory, size_t size)
+static void lone_lisp_initialize(struct lone_lisp *lone, unsigned char *memory, size_t size, void *native_stack)
 {
-	lone->memory = (struct lone_memory *) memory;
-	lone->memory->prev = lone->memory->next = 0;
-	lone->memory->free = 1;
-	lone->memory->size = size - sizeof(struct lone_memory);
-	lone->values = 0;
+	size_t i;
+
+	lone->memory.blocks = (struct lone_memory *) memory;
+	lone->memory.blocks->prev = lone->memory.blocks->next = 0;
+	lone->memory.blocks->free = 1;
+	lone->memory.blocks->size = size - sizeof(struct lone_memory);
+	lone->memory.regions = 0;
+	for (i = 0; i < LONE_MEMORY_SIZE_CLASSES; ++i) { lone->memory.free[i] = 0; }
+	lone->memory.bump.current = lone->memory.bump.end = 0;
+	lone->memory.initial.pointer = memory;
+	lone->memory.initial.size = size;
+	lone->values.slabs = 0;
+	lone->values.free = 0;
+	lone->values.batches.starts = 0;
+	lone->values.batches.count = lone->values.batches.capacity = 0;
+	lone->collector.allocated = 0;
+	lone->collector.threshold = LONE_COLLECTOR_MINIMUM_THRESHOLD;
+	lone->collector.old = 0;
+	lone->collector.limit = LONE_COLLECTOR_MINIMUM_THRESHOLD;
+	lone->collector.stack.values = 0;
+	lone->collector.stack.count = lone->collector.stack.capacity = 0;
+	lone->collector.statistics.collections = lone->collector.statistics.major = 0;
+	lone->collector.statistics.freed = 0;
+	lone->collector.statistics.ticks = lone->collector.statistics.total = 0;
+	lone->collector.log = 0;
+	lone->native_stack = native_stack;
+	for (i = 0; i < LONE_FRAME_POOL_ARGUMENTS; ++i) { lone->frames.free[i] = 0; lone->frames.count[i] = 0; }
+	lone->output.file_descriptor = -1;
+	lone->output.count = 0;
+	lone->nil = 0;
+	lone->nil = lone_list_create(lone, 0, 0);
+	lone->tail.environment = 0;
+	lone->output.buffer = lone_allocate(lone, LONE_OUTPUT_BUFFER_SIZE);
 	lone->symbol_table = lone_table_create(lone, 256, 0);
 	lone->modules.loaded = lone_table_create(lone, 32, 0);
 	struct lone_function_flags import_flags = { .evaluate_arguments = 0, .evaluate_result = 0, .variable_arguments = 1 };
 	lone->modules.import = lone_primitive_create(lone, "import", lone_primitive_import, 0, import_flags);
 	lone->modules.null = lone_module_create(lone, 0);
+	lone->profiler.enabled = 0;
+	lone->profiler.metric = LONE_PROFILE_TIME;
+	lone->profiler.last = 0;
+	lone->profiler.root = lone->profiler.current = lone->profiler.all = 0;
+	lone->profiler.count = 0;
 }
 
 static struct lone_value *lone_value_create(struct lone_lisp *lone)
 {
-	struct lone_value_container *container = lone_allocate(lone, sizeof(struct lone_value_container));
-	if (lone->values) { container->header.next = lone->values; }
-	lone->values = container;
-	container->header.marked = 0;
-	return &container->value;
+	struct lone_value *value;
+	struct lone_value_slab *slab;
+
+	if (++lone->collector.allocated > lone->collector.threshold) { lone_garbage_collector(lone); }
+	if (!lone->values.free) { lone_value_slabs_grow(lone); }
+	if (lone->profiler.enabled) { lone->profiler.current->bytes += sizeof(*value); }
+
+	value = (struct lone_value *) lone->values.free;
+	lone->values.free = lone->values.free->next;
+
+	slab = lone_value_to_slab(value);
+	lone_bitmap_set(slab->allocated, lone_value_slab_index(slab, value));
+
+	/* the collector may run before the value is fully initialized */
+	value->type = LONE_INTEGER;
+
+	return value;
+}
+
+/* the bytes must outlive the value, it will not deallocate them */
+static struct lone_value *lone_bytes_create_borrowed(struct lone_lisp *lone, unsigned char *pointer, size_t count)
+{
+	struct lone_value *value = lone_value_create(lone);
+	value->type = LONE_BYTES;
+	value->borrowed = 1;
+	value->system_call = 0;
+	value->bytes.count = count;
+	value->bytes.pointer = pointer;
+	value->hash = 0;
+	value->owner = 0;
+	return value;
 }
 
 static struct lone_value *lone_bytes_create(struct lone_lisp *lone, unsigned char *pointer, size_t count)
 {
-	struct lone_value *value = lone_value_create(lone);
 	unsigned char *copy = lone_allocate(lone, count);
+	struct lone_value *value;
 	lone_memory_move(pointer, copy, count);
-	value->type = LONE_BYTES;
-	value->bytes.count = count;
-	value->bytes.pointer = copy;
+	value = lone_bytes_create_borrowed(lone, copy, count);
+	value->borrowed = 0;
 	return value;
 }
 
@@ -450,15 +1302,18 @@ static struct lone_value *lone_list_create(struct lone_lisp *lone, struct lone_v
 	value->type = LONE_LIST;
 	value->list.first = first;
 	value->list.rest = rest;
+	value->list.address.function = 0;
 	return value;
 }
 
 static struct lone_value *lone_list_create_nil(struct lone_lisp *lone)
 {
-	return lone_list_create(lone, 0, 0);
+	/* there is only one nil and it must never be modified */
+	return lone->nil;
 }
 
 static struct lone_value *lone_intern_c_string(struct lone_lisp *, char *);
+static void lone_frame_escape(struct lone_value *);
 
 static struct lone_value *lone_function_create(struct lone_lisp *lone, struct lone_value *arguments, struct lone_value *code, struct lone_value *environment, struct lone_function_flags flags)
 {
@@ -467,19 +1322,30 @@ static struct lone_value *lone_function_create(struct lone_lisp *lone, struct lo
 	value->function.arguments = arguments;
 	value->function.code = code;
 	value->function.environment = environment;
-	value->function.flags = flags;
+	value->function.bytecode = 0;
+	value->flags = flags;
+	lone_frame_escape(environment);
 	return value;
 }
 
 static struct lone_value *lone_primitive_create(struct lone_lisp *lone, char *name, lone_primitive function, struct lone_value *closure, struct lone_function_flags flags)
 {
-	struct lone_value *value = lone_value_create(lone);
+	struct lone_value *symbol = lone_intern_c_string(lone, name),
+	                  *value = lone_value_create(lone);
 	value->type = LONE_PRIMITIVE;
-	value->primitive.name = lone_intern_c_string(lone, name);
+	value->primitive.name = symbol;
 	value->primitive.function = function;
+	value->primitive.fast = 0;
 	value->primitive.closure = closure;
-	value->primitive.flags = flags;
-	value->primitive.flags.variable_arguments = 1;
+	value->flags = flags;
+	value->flags.variable_arguments = 1;             /* primitives always accept variable arguments */
+	return value;
+}
+
+static struct lone_value *lone_primitive_create_fast(struct lone_lisp *lone, char *name, lone_primitive_fast fast, struct lone_value *closure, struct lone_function_flags flags)
+{
+	struct lone_value *value = lone_primitive_create(lone, name, 0, closure, flags);
+	value->primitive.fast = fast;
 	return value;
 }
 
@@ -487,33 +1353,42 @@ static struct lone_value *lone_vector_create(struct lone_lisp *lone, size_t capa
 {
 	struct lone_value *value = lone_value_create(lone);
 	value->type = LONE_VECTOR;
+	value->escaped = 0;
 	value->vector.capacity = capacity;
 	value->vector.count = 0;
 	value->vector.values = lone_allocate(lone, capacity * sizeof(*value->vector.values));
-	for (size_t i = 0; i < value->vector.capacity; ++i) { value->vector.values[i] = 0; }
+	lone_memory_zero(value->vector.values, value->vector.capacity * sizeof(*value->vector.values));
 	return value;
 }
 
 static struct lone_value *lone_table_create(struct lone_lisp *lone, size_t capacity, struct lone_value *prototype)
 {
 	struct lone_value *value = lone_value_create(lone);
+	size_t power = 1;
+
+	/* capacities must be powers of two */
+	while (power < capacity) { power *= 2; }
+	capacity = power;
+
 	value->type = LONE_TABLE;
+	value->version = 0;
 	value->table.prototype = prototype;
 	value->table.capacity = capacity;
 	value->table.count = 0;
 	value->table.entries = lone_allocate(lone, capacity * sizeof(*value->table.entries));
-
-	for (size_t i = 0; i < capacity; ++i) {
-		value->table.entries[i].key = 0;
-		value->table.entries[i].value = 0;
-	}
+	lone_memory_zero(value->table.entries, capacity * sizeof(*value->table.entries));
 
 	return value;
 }
 
 static struct lone_value *lone_integer_create(struct lone_lisp *lone, long integer)
 {
-	struct lone_value *value = lone_value_create(lone);
+	unsigned long fixnum = ((unsigned long) integer << 1) | LONE_FIXNUM_TAG;
+	struct lone_value *value;
+
+	if ((long) fixnum >> 1 == integer) { return (struct lone_value *) fixnum; }
+
+	value = lone_value_create(lone);
 	value->type = LONE_INTEGER;
 	value->integer = integer;
 	return value;
@@ -540,14 +1415,21 @@ static struct lone_value *lone_pointer_create(struct lone_lisp *lone, void *poin
 {
 	struct lone_value *value = lone_value_create(lone);
 	value->type = LONE_POINTER;
+	value->io_uring = 0;
 	value->pointer = pointer;
 	return value;
 }
 
+/* texts end in a null byte so that they can be given to the kernel as C strings */
 static struct lone_value *lone_text_create(struct lone_lisp *lone, unsigned char *text, size_t length)
 {
-	struct lone_value *value = lone_bytes_create(lone, text, length);
+	unsigned char *copy = lone_allocate(lone, length + 1);
+	struct lone_value *value;
+	lone_memory_move(text, copy, length);
+	copy[length] = '\0';
+	value = lone_bytes_create_borrowed(lone, copy, length);
 	value->type = LONE_TEXT;
+	value->borrowed = 0;
 	return value;
 }
 
@@ -578,10 +1460,12 @@ static struct lone_value *lone_symbol_create_from_c_string(struct lone_lisp *lon
 
 static struct lone_value *lone_module_create(struct lone_lisp *lone, struct lone_value *name)
 {
-	struct lone_value *value = lone_value_create(lone);
+	struct lone_value *environment = lone_table_create(lone, 64, 0),
+	                  *value = lone_value_create(lone);
 	value->type = LONE_MODULE;
 	value->module.name = name;
-	value->module.environment = lone_table_create(lone, 64, 0);
+	value->module.environment = environment;
+	value->module.deferred = 0;
 	lone_table_set(lone, value->module.environment, lone_intern_c_string(lone, "import"), lone->modules.import);
 	return value;
 }
@@ -603,24 +1487,53 @@ static inline struct lone_value *lone_list_rest(struct lone_value *value)
 
 static int lone_is_nil(struct lone_value *value)
 {
-	return value->type == LONE_LIST && value->list.first == 0 && value->list.rest == 0;
+	return !lone_is_fixnum(value) && value->type == LONE_LIST && value->list.first == 0 && value->list.rest == 0;
 }
 
-static struct lone_value *lone_list_set(struct lone_value *list, struct lone_value *value)
+static struct lone_value *lone_list_append(struct lone_value *list, struct lone_value *rest)
 {
-	return list->list.first = value;
+	lone_write_barrier(list);
+	return list->list.rest = rest;
 }
 
-static struct lone_value *lone_list_append(struct lone_value *list, struct lone_value *rest)
+static struct lone_value *lone_list_build(struct lone_lisp *lone, struct lone_value **first, struct lone_value *last, struct lone_value *value)
 {
-	return list->list.rest = rest;
+	struct lone_value *list = lone_list_create(lone, value, lone_list_create_nil(lone));
+
+	/* lists are built from the first element to the last, never from nil */
+	if (last) { lone_list_append(last, list); } else { *first = list; }
+
+	return list;
+}
+
+static struct lone_value *lone_list_from_values(struct lone_lisp *lone, struct lone_value **values, size_t count)
+{
+	struct lone_value *first = 0, *last = 0;
+	size_t i;
+
+	for (i = 0; i < count; ++i) {
+		last = lone_list_build(lone, &first, last, values[i]);
+	}
+
+	return first? first : lone_list_create_nil(lone);
+}
+
+static size_t lone_list_count(struct lone_value *list)
+{
+	size_t count = 0;
+
+	/* the number of elements of a proper list or -1 */
+	for (/* list */; !lone_is_nil(list); list = lone_list_rest(list), ++count) {
+		if (lone_type_of(list) != LONE_LIST) { return -1; }
+	}
+
+	return count;
 }
 
 static int lone_bytes_equals(struct lone_bytes x, struct lone_bytes y)
 {
 	if (x.count != y.count) return 0;
-	for (size_t i = 0; i < x.count; ++i) if (x.pointer[i] != y.pointer[i]) return 0;
-	return 1;
+	return memory_compare(x.pointer, y.pointer, x.count) == 0;
 }
 
 static inline int lone_bytes_equals_c_string(struct lone_bytes bytes, char *c_string)
@@ -631,12 +1544,15 @@ static inline int lone_bytes_equals_c_string(struct lone_bytes bytes, char *c_st
 
 static void lone_vector_resize(struct lone_lisp *lone, struct lone_value *vector, size_t new_capacity)
 {
-	struct lone_value **new = lone_allocate(lone, new_capacity * sizeof(struct lone_value *));
-	size_t i;
+	struct lone_value **new;
+	size_t size, kept;
 
-	for (i = 0; i < new_capacity; ++i) {
-		new[i] = i < vector->vector.count? vector->vector.values[i] : 0;
-	}
+	if (__builtin_mul_overflow(new_capacity, sizeof(*new), &size)) { /* vector too large: ([] 2305843009213693951 0) */ lone_exit(lone, -1); }
+	new = lone_allocate(lone, size);
+	kept = vector->vector.count < new_capacity? vector->vector.count : new_capacity;
+
+	lone_memory_move(vector->vector.values, new, kept * sizeof(*new));
+	lone_memory_zero(new + kept, (new_capacity - kept) * sizeof(*new));
 
 	lone_deallocate(lone, vector->vector.values);
 
@@ -649,22 +1565,45 @@ static struct lone_value *lone_vector_get(struct lone_lisp *lone, struct lone_va
 {
 	struct lone_value *value;
 	size_t i;
-	if (index->type != LONE_INTEGER) { /* only integer indexes supported */ linux_exit(-1); }
-	i = index->integer;
+	if (lone_type_of(index) != LONE_INTEGER) { /* only integer indexes supported */ lone_exit(lone, -1); }
+	i = lone_integer_of(index);
 	value = i < vector->vector.capacity? vector->vector.values[i] : 0;
 	return value? value : lone_list_create_nil(lone);
 }
 
-static void lone_vector_set(struct lone_lisp *lone, struct lone_value *vector, struct lone_value *index, struct lone_value *value)
+#define LONE_VECTOR_MINIMUM_CAPACITY 8
+
+/* capacities double so that growing by one element at a time takes amortized constant time */
+static void lone_vector_grow(struct lone_lisp *lone, struct lone_value *vector, size_t needed_capacity)
 {
-	size_t i;
-	if (index->type != LONE_INTEGER) { /* only integer indexes supported */ linux_exit(-1); }
-	i = index->integer;
-	if (i >= vector->vector.capacity) { lone_vector_resize(lone, vector, i * 2); }
+	size_t new_capacity = vector->vector.capacity? vector->vector.capacity : LONE_VECTOR_MINIMUM_CAPACITY;
+
+	if (needed_capacity <= vector->vector.capacity) { return; }
+	while (new_capacity < needed_capacity) { new_capacity *= 2; }
+
+	lone_vector_resize(lone, vector, new_capacity);
+}
+
+static void lone_vector_set_index(struct lone_lisp *lone, struct lone_value *vector, size_t i, struct lone_value *value)
+{
+	lone_vector_grow(lone, vector, i + 1);
+	lone_write_barrier(vector);
 	vector->vector.values[i] = value;
 	if (++i > vector->vector.count) { vector->vector.count = i; }
 }
 
+static void lone_vector_set(struct lone_lisp *lone, struct lone_value *vector, struct lone_value *index, struct lone_value *value)
+{
+	if (lone_type_of(index) != LONE_INTEGER) { /* only integer indexes supported */ lone_exit(lone, -1); }
+	if (lone_integer_of(index) < 0) { /* negative index: ([] -1 0) */ lone_exit(lone, -1); }
+	lone_vector_set_index(lone, vector, lone_integer_of(index), value);
+}
+
+static void lone_vector_push(struct lone_lisp *lone, struct lone_value *vector, struct lone_value *value)
+{
+	lone_vector_set_index(lone, vector, vector->vector.count, value);
+}
+
 static unsigned long  __attribute__((pure)) fnv_1a(unsigned char *bytes, size_t count)
 {
 	unsigned long hash = FNV_OFFSET_BASIS;
@@ -677,11 +1616,17 @@ static unsigned long  __attribute__((pure)) fnv_1a(unsigned char *bytes, size_t
 	return hash;
 }
 
-static inline size_t lone_table_compute_hash_for(struct lone_value *key, size_t capacity)
+static inline unsigned long __attribute__((const)) lone_hash_integer(long integer)
 {
-	unsigned long result;
+	unsigned long hash = (unsigned long) integer * GOLDEN_RATIO_MULTIPLIER;
+
+	/* the table index is taken from the low bits which are poorly mixed */
+	return hash ^ (hash >> (__BITS_PER_LONG / 2));
+}
 
-	switch (key->type) {
+static unsigned long lone_hash(struct lone_lisp *lone, struct lone_value *key)
+{
+	switch (lone_type_of(key)) {
 	case LONE_MODULE:
 	case LONE_FUNCTION:
 	case LONE_PRIMITIVE:
@@ -689,42 +1634,101 @@ static inline size_t lone_table_compute_hash_for(struct lone_value *key, size_t
 	case LONE_VECTOR:
 	case LONE_TABLE:
 	case LONE_POINTER:
-		linux_exit(-1);
+	case LONE_READER:
+		lone_exit(lone, -1);
 	case LONE_SYMBOL:
 	case LONE_TEXT:
+		/* texts and symbols are immutable so their hash is computed only once */
+		if (!key->hash) { key->hash = fnv_1a(key->bytes.pointer, key->bytes.count); }
+		return key->hash;
 	case LONE_BYTES:
-		result = fnv_1a(key->bytes.pointer, key->bytes.count);
-		break;
+		/* bytes may be changed in place */
+		return fnv_1a(key->bytes.pointer, key->bytes.count);
 	case LONE_INTEGER:
-		result = fnv_1a((unsigned char *) &key->integer, sizeof(key->integer));
-		break;
+		return lone_hash_integer(lone_integer_of(key));
+	}
+}
+
+static inline size_t lone_table_compute_hash_for(struct lone_lisp *lone, struct lone_value *key, size_t capacity)
+{
+	return lone_hash(lone, key) & (capacity - 1);
+}
+
+static int lone_table_key_equals(struct lone_value *x, struct lone_value *y)
+{
+	if (x == y) { return 1; }
+
+	if (lone_type_of(x) == LONE_INTEGER || lone_type_of(y) == LONE_INTEGER) {
+		return lone_type_of(x) == lone_type_of(y) && lone_integer_of(x) == lone_integer_of(y);
+	}
+
+	/* symbols are interned: distinct symbols never have the same name */
+	if (x->type == LONE_SYMBOL && y->type == LONE_SYMBOL) { return 0; }
+
+	if (x->hash && y->hash && x->hash != y->hash) { return 0; }
+
+	return lone_bytes_equals(x->bytes, y->bytes);
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Table capacities are always powers of two so that indexes can       │
+   │    be wrapped around by masking instead of dividing. Collisions        │
+   │    are resolved by Robin Hood linear probing: an entry being           │
+   │    inserted takes the place of any entry closer to its own home        │
+   │    index, which then continues probing in its stead. This keeps        │
+   │    probe sequences short and lets lookups of missing keys stop         │
+   │    as soon as they are further from home than the current entry.       │
+   │    Deletion shifts the following entries back by one position.         │
+   │                                                                        │
+   │    https://en.wikipedia.org/wiki/Hash_table#Robin_Hood_hashing         │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static inline size_t lone_table_entry_distance(struct lone_lisp *lone, struct lone_table_entry *entries, size_t capacity, size_t i)
+{
+	return (i - lone_table_compute_hash_for(lone, entries[i].key, capacity)) & (capacity - 1);
+}
+
+static struct lone_table_entry *lone_table_entry_find(struct lone_lisp *lone, struct lone_table_entry *entries, size_t capacity, struct lone_value *key)
+{
+	size_t i = lone_table_compute_hash_for(lone, key, capacity), distance;
+
+	for (distance = 0; entries[i].key; ++distance, i = (i + 1) & (capacity - 1)) {
+		if (lone_table_key_equals(entries[i].key, key)) { return &entries[i]; }
+		if (lone_table_entry_distance(lone, entries, capacity, i) < distance) { break; }
 	}
 
-	return result % capacity;
+	return 0;
 }
 
-static size_t lone_table_entry_find_index_for(struct lone_value *key, struct lone_table_entry *entries, size_t capacity)
+static void lone_table_entry_insert(struct lone_lisp *lone, struct lone_table_entry *entries, size_t capacity, struct lone_value *key, struct lone_value *value)
 {
-	size_t i = lone_table_compute_hash_for(key, capacity);
+	size_t i = lone_table_compute_hash_for(lone, key, capacity), distance, existing;
+	struct lone_table_entry entry = { key, value }, displaced;
+
+	for (distance = 0; entries[i].key; ++distance, i = (i + 1) & (capacity - 1)) {
+		existing = lone_table_entry_distance(lone, entries, capacity, i);
 
-	while (entries[i].key && !lone_bytes_equals(entries[i].key->bytes, key->bytes)) {
-		i = (i + 1) % capacity;
+		if (existing < distance) {
+			displaced = entries[i];
+			entries[i] = entry;
+			entry = displaced;
+			distance = existing;
+		}
 	}
 
-	return i;
+	entries[i] = entry;
 }
 
-static int lone_table_entry_set(struct lone_table_entry *entries, size_t capacity, struct lone_value *key, struct lone_value *value)
+static int lone_table_entry_set(struct lone_lisp *lone, struct lone_table_entry *entries, size_t capacity, struct lone_value *key, struct lone_value *value)
 {
-	size_t i = lone_table_entry_find_index_for(key, entries, capacity);
-	struct lone_table_entry *entry = &entries[i];
+	struct lone_table_entry *entry = lone_table_entry_find(lone, entries, capacity, key);
 
-	if (entry->key) {
+	if (entry) {
 		entry->value = value;
 		return 0;
 	} else {
-		entry->key = key;
-		entry->value = value;
+		lone_table_entry_insert(lone, entries, capacity, key, value);
 		return 1;
 	}
 }
@@ -735,20 +1739,19 @@ static void lone_table_resize(struct lone_lisp *lone, struct lone_value *table,
 	struct lone_table_entry *old = table->table.entries,
 	                        *new = lone_allocate(lone, new_capacity * sizeof(*new));
 
-	for (i = 0; i < new_capacity; ++i) {
-		new[i].key = 0;
-		new[i].value = 0;
-	}
+	lone_memory_zero(new, new_capacity * sizeof(*new));
 
 	for (i = 0; i < old_capacity; ++i) {
 		if (old[i].key) {
-			lone_table_entry_set(new, new_capacity, old[i].key, old[i].value);
+			/* keys are already known to be distinct */
+			lone_table_entry_insert(lone, new, new_capacity, old[i].key, old[i].value);
 		}
 	}
 
 	lone_deallocate(lone, old);
 	table->table.entries = new;
 	table->table.capacity = new_capacity;
+	++table->version;
 }
 
 static void lone_table_set(struct lone_lisp *lone, struct lone_value *table, struct lone_value *key, struct lone_value *value)
@@ -757,21 +1760,21 @@ static void lone_table_set(struct lone_lisp *lone, struct lone_value *table, str
 		lone_table_resize(lone, table, table->table.capacity * 2);
 	}
 
-	if (lone_table_entry_set(table->table.entries, table->table.capacity, key, value)) {
+	lone_write_barrier(table);
+
+	if (lone_table_entry_set(lone, table->table.entries, table->table.capacity, key, value)) {
+		/* insertion may have moved other entries */
 		++table->table.count;
+		++table->version;
 	}
 }
 
 static struct lone_value *lone_table_get(struct lone_lisp *lone, struct lone_value *table, struct lone_value *key)
 {
-	size_t capacity = table->table.capacity, i;
-	struct lone_table_entry *entries = table->table.entries, *entry;
+	struct lone_table_entry *entry = lone_table_entry_find(lone, table->table.entries, table->table.capacity, key);
 	struct lone_value *prototype = table->table.prototype;
 
-	i = lone_table_entry_find_index_for(key, entries, capacity);
-	entry = &entries[i];
-
-	if (entry->key) {
+	if (entry) {
 		return entry->value;
 	} else if (prototype && !lone_is_nil(prototype)) {
 		return lone_table_get(lone, prototype, key);
@@ -782,69 +1785,379 @@ static struct lone_value *lone_table_get(struct lone_lisp *lone, struct lone_val
 
 static void lone_table_delete(struct lone_lisp *lone, struct lone_value *table, struct lone_value *key)
 {
-	size_t capacity = table->table.capacity, i, j, k;
-	struct lone_table_entry *entries = table->table.entries;
+	size_t capacity = table->table.capacity, i, j;
+	struct lone_table_entry *entries = table->table.entries, *entry;
 
-	i = lone_table_entry_find_index_for(key, entries, capacity);
+	entry = lone_table_entry_find(lone, entries, capacity, key);
 
-	if (!entries[i].key) { return; }
+	if (!entry) { return; }
 
-	j = i;
+	i = entry - entries;
 	while (1) {
-		j = (j + 1) % capacity;
-		if (!entries[j].key) { break; }
-		k = lone_table_compute_hash_for(entries[j].key, capacity);
-		if ((j > i && (k <= i || k > j)) || (j < i && (k <= i && k > j))) {
-			entries[i] = entries[j];
-			i = j;
-		}
+		j = (i + 1) & (capacity - 1);
+		if (!entries[j].key || lone_table_entry_distance(lone, entries, capacity, j) == 0) { break; }
+		entries[i] = entries[j];
+		i = j;
 	}
 
 	entries[i].key = 0;
 	entries[i].value = 0;
 	--table->table.count;
+	++table->version;
 }
 
-static struct lone_value *lone_intern(struct lone_lisp *lone, unsigned char *bytes, size_t count)
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Environments are either tables or frames. Modules and let use       │
+   │    tables whose prototypes are their parent environments. Frames       │
+   │    are created when functions are applied and are plain vectors:       │
+   │                                                                        │
+   │        [ function, bindings, argument, argument, ... ]                 │
+   │                                                                        │
+   │    Each parameter of the function has its own slot. Variables          │
+   │    which are set or imported in the frame but are not parameters       │
+   │    go into a bindings table which is only created when needed.         │
+   │    The parent of a frame is the environment of its function.           │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+#define LONE_FRAME_FUNCTION 0
+#define LONE_FRAME_BINDINGS 1
+#define LONE_FRAME_SLOTS 2
+
+static inline int lone_is_frame(struct lone_value *environment)
 {
-	struct lone_value *key = lone_bytes_create(lone, bytes, count),
-	                  *value = lone_table_get(lone, lone->symbol_table, key);
+	return environment->type == LONE_VECTOR;
+}
 
-	if (lone_is_nil(value)) {
-		value = lone_symbol_create(lone, bytes, count);
-		lone_table_set(lone, lone->symbol_table, key, value);
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Most frames are garbage as soon as their calls return. Nothing      │
+   │    but the function being called can see a frame unless a closure      │
+   │    is created in it or in a let nested inside it. Creating a           │
+   │    function therefore marks every frame above its environment as       │
+   │    escaped. Frames which have not escaped are recycled by calls        │
+   │    whose results need no further evaluation: they are cleared and      │
+   │    pooled by argument count linked through their function slots.       │
+   │    Frames are taken from the pools before any are allocated and        │
+   │    escaped frames are left to the garbage collector.                   │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static void lone_frame_escape(struct lone_value *environment)
+{
+	while (environment && !lone_is_nil(environment)) {
+		if (lone_is_frame(environment)) {
+			/* frames above an escaped frame have escaped too */
+			if (environment->escaped) { return; }
+			environment->escaped = 1;
+			environment = environment->vector.values[LONE_FRAME_FUNCTION]->function.environment;
+		} else {
+			environment = environment->table.prototype;
+		}
 	}
+}
 
-	return value;
+static struct lone_value *lone_frame_create(struct lone_lisp *lone, struct lone_value *function, size_t count)
+{
+	struct lone_value *frame;
+
+	if (count < LONE_FRAME_POOL_ARGUMENTS && (frame = lone->frames.free[count])) {
+		lone->frames.free[count] = frame->vector.values[LONE_FRAME_FUNCTION];
+		--lone->frames.count[count];
+		/* recycled frames may be old, the caller stores values in them */
+		lone_write_barrier(frame);
+	} else {
+		frame = lone_vector_create(lone, LONE_FRAME_SLOTS + count);
+		frame->vector.count = LONE_FRAME_SLOTS + count;
+	}
+
+	frame->vector.values[LONE_FRAME_FUNCTION] = function;
+	return frame;
 }
 
-static struct lone_value *lone_intern_c_string(struct lone_lisp *lone, char *c_string)
+static void lone_frame_recycle(struct lone_lisp *lone, struct lone_value *frame)
 {
-	return lone_intern(lone, (unsigned char *) c_string, lone_c_string_length(c_string));
+	size_t count = frame->vector.count - LONE_FRAME_SLOTS;
+
+	if (frame->escaped || count >= LONE_FRAME_POOL_ARGUMENTS) { return; }
+	if (lone->frames.count[count] >= LONE_FRAME_POOL_DEPTH) { return; }
+
+	/* cleared so that pooled frames keep nothing else alive */
+	lone_write_barrier(frame);
+	lone_memory_zero(frame->vector.values, frame->vector.count * sizeof(*frame->vector.values));
+	frame->vector.values[LONE_FRAME_FUNCTION] = lone->frames.free[count];
+	lone->frames.free[count] = frame;
+	++lone->frames.count[count];
 }
 
-/* ╭─────────────────────────┨ LONE LISP READER ┠───────────────────────────╮
-   │                                                                        │
-   │    The reader's job is to transform input into lone lisp values.       │
-   │    It accomplishes the task by reading input from a given file         │
-   │    descriptor and then lexing and parsing the results.                 │
-   │                                                                        │
-   │    The lexer or tokenizer transforms a linear stream of characters     │
-   │    into a linear stream of tokens suitable for parser consumption.     │
-   │    This gets rid of insignificant whitespace and reduces the size      │
-   │    of the parser's input significantly.                                │
-   │                                                                        │
-   │    It consists of an input buffer, its current position in it          │
-   │    as well as two functions:                                           │
-   │                                                                        │
-   │        ◦ peek(k) which returns the character at i+k                    │
-   │        ◦ consume(k) which advances i by k positions                    │
-   │                                                                        │
-   │    The parser transforms a linear sequence of tokens into a nested     │
-   │    sequence of lisp objects suitable for evaluation.                   │
-   │    Its main task is to match nested structures such as lists.          │
+static inline struct lone_value *lone_frame_function(struct lone_value *frame)
+{
+	return frame->vector.values[LONE_FRAME_FUNCTION];
+}
+
+static inline struct lone_value *lone_frame_bindings(struct lone_value *frame)
+{
+	return frame->vector.values[LONE_FRAME_BINDINGS];
+}
+
+static inline struct lone_value *lone_frame_parent(struct lone_value *frame)
+{
+	return lone_frame_function(frame)->function.environment;
+}
+
+static inline struct lone_value **lone_frame_slot(struct lone_value *frame, size_t slot)
+{
+	return &frame->vector.values[LONE_FRAME_SLOTS + slot];
+}
+
+static long lone_function_parameter_slot(struct lone_value *function, struct lone_value *symbol)
+{
+	struct lone_value *names = function->function.arguments;
+	long slot;
+
+	for (slot = 0; !lone_is_nil(names); names = lone_list_rest(names), ++slot) {
+		if (lone_list_first(names) == symbol) { return slot; }
+	}
+
+	return -1;
+}
+
+static struct lone_value *lone_environment_find(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *symbol)
+{
+	struct lone_table_entry *entry;
+	struct lone_value *bindings;
+	long slot;
+
+	while (environment && !lone_is_nil(environment)) {
+		if (lone_is_frame(environment)) {
+			slot = lone_function_parameter_slot(lone_frame_function(environment), symbol);
+			if (slot >= 0) { return *lone_frame_slot(environment, slot); }
+
+			bindings = lone_frame_bindings(environment);
+			if (bindings) {
+				entry = lone_table_entry_find(lone, bindings->table.entries, bindings->table.capacity, symbol);
+				if (entry) { return entry->value; }
+			}
+
+			environment = lone_frame_parent(environment);
+		} else {
+			entry = lone_table_entry_find(lone, environment->table.entries, environment->table.capacity, symbol);
+			if (entry) { return entry->value; }
+
+			environment = environment->table.prototype;
+		}
+	}
+
+	return 0;
+}
+
+static struct lone_value *lone_environment_get(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *symbol)
+{
+	struct lone_value *value = lone_environment_find(lone, environment, symbol);
+	return value? value : lone_list_create_nil(lone);
+}
+
+static void lone_environment_set(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *symbol, struct lone_value *value)
+{
+	struct lone_value *bindings;
+	long slot;
+
+	if (!lone_is_frame(environment)) {
+		lone_table_set(lone, environment, symbol, value);
+		return;
+	}
+
+	slot = lone_function_parameter_slot(lone_frame_function(environment), symbol);
+	if (slot >= 0) {
+		lone_write_barrier(environment);
+		*lone_frame_slot(environment, slot) = value;
+		return;
+	}
+
+	bindings = lone_frame_bindings(environment);
+	if (!bindings) {
+		bindings = lone_table_create(lone, 8, 0);
+		lone_write_barrier(environment);
+		environment->vector.values[LONE_FRAME_BINDINGS] = bindings;
+	}
+
+	lone_table_set(lone, bindings, symbol, value);
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    References to parameters are compiled into lexical addresses:       │
+   │    how many parent frames to skip and which slot to read. Since a      │
+   │    function's environment never changes, the frames above one of       │
+   │    its frames are always the same and so is the address of any         │
+   │    given symbol. The address is stored in the list cell whose first    │
+   │    element is the symbol, along with the function it is valid for.     │
+   │                                                                        │
+   │    Whether a list is code or data is only known when it is actually    │
+   │    evaluated since operators such as quote and lambda! are values.     │
+   │    So references are resolved the first time they are evaluated        │
+   │    in a frame of a function rather than when the function is made.     │
+   │    Variables set in a frame would shadow parameters of its parents     │
+   │    so addresses are only used when skipped frames have no bindings.    │
+   │                                                                        │
+   │    Symbols which are not parameters are resolved to the first          │
+   │    table above the frames, usually a module environment. Its entry     │
+   │    for the symbol is cached in the list cell along with the version    │
+   │    of the table, which changes whenever keys are added or removed.     │
+   │    The cached entry is used for as long as the versions match.         │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+#define LONE_ADDRESS_LIMIT 0xFFFF
+#define LONE_ADDRESS_UNCACHED LONE_ADDRESS_LIMIT
+
+static int lone_resolve(struct lone_value *list, struct lone_value *function)
+{
+	struct lone_value *symbol = lone_list_first(list), *current = function, *environment;
+	unsigned int depth = 0;
+	long slot;
+
+	while ((slot = lone_function_parameter_slot(current, symbol)) < 0) {
+		environment = current->function.environment;
+		++depth;
+
+		if (!environment || !lone_is_frame(environment)) {
+			/* the entry will be cached when it is first looked up */
+			slot = LONE_ADDRESS_UNCACHED;
+			break;
+		}
+
+		current = lone_frame_function(environment);
+	}
+
+	if (depth >= LONE_ADDRESS_LIMIT || slot > LONE_ADDRESS_LIMIT) { return 0; }
+
+	lone_write_barrier(list);
+	list->list.address.function = function;
+	list->list.address.depth = depth;
+	list->list.address.slot = slot;
+	return 1;
+}
+
+static struct lone_value *lone_evaluate_cached(struct lone_lisp *lone, struct lone_value *table, struct lone_value *list)
+{
+	struct lone_value *symbol = lone_list_first(list);
+	struct lone_table_entry *entry;
+	size_t slot = list->list.address.slot;
+
+	if (!table || lone_is_nil(table)) { return lone_list_create_nil(lone); }
+
+	if (slot != LONE_ADDRESS_UNCACHED && list->list.address.version == table->version) {
+		return table->table.entries[slot].value;
+	}
+
+	entry = lone_table_entry_find(lone, table->table.entries, table->table.capacity, symbol);
+	if (!entry) {
+		/* only entries of the table itself are cached, not of its prototypes */
+		return lone_environment_get(lone, table, symbol);
+	}
+
+	slot = entry - table->table.entries;
+	if (slot < LONE_ADDRESS_LIMIT) {
+		list->list.address.slot = slot;
+		list->list.address.version = table->version;
+	}
+
+	return entry->value;
+}
+
+static struct lone_value *lone_evaluate_reference(struct lone_lisp *lone, struct lone_value *frame, struct lone_value *list)
+{
+	struct lone_value *symbol = lone_list_first(list), *environment = frame, *bindings;
+	unsigned int depth;
+
+	if (list->list.address.function != lone_frame_function(frame) && !lone_resolve(list, lone_frame_function(frame))) {
+		return lone_environment_get(lone, frame, symbol);
+	}
+
+	for (depth = list->list.address.depth; depth; --depth) {
+		bindings = lone_frame_bindings(environment);
+		if (bindings && lone_table_entry_find(lone, bindings->table.entries, bindings->table.capacity, symbol)) {
+			return lone_environment_get(lone, frame, symbol);
+		}
+		environment = lone_frame_parent(environment);
+	}
+
+	/* the frames of a function are always followed by the same environments */
+	if (!environment || !lone_is_frame(environment)) {
+		return lone_evaluate_cached(lone, environment, list);
+	}
+
+	return *lone_frame_slot(environment, list->list.address.slot);
+}
+
+static struct lone_value *lone_intern_bytes(struct lone_lisp *lone, unsigned char *bytes, size_t count, int borrow)
+{
+	struct lone_value key, *value;
+
+	/* looked up by a temporary text borrowing the bytes, hashed once for the lookup and the new symbol */
+	key.type = LONE_TEXT;
+	key.bytes.count = count;
+	key.bytes.pointer = bytes;
+	key.hash = fnv_1a(bytes, count);
+
+	value = lone_table_get(lone, lone->symbol_table, &key);
+
+	if (lone_is_nil(value)) {
+		/* symbols are their own keys in the symbol table */
+		value = borrow? lone_bytes_create_borrowed(lone, bytes, count) : lone_bytes_create(lone, bytes, count);
+		value->type = LONE_SYMBOL;
+		value->hash = key.hash;
+		lone_table_set(lone, lone->symbol_table, value, value);
+	}
+
+	return value;
+}
+
+static struct lone_value *lone_intern(struct lone_lisp *lone, unsigned char *bytes, size_t count)
+{
+	return lone_intern_bytes(lone, bytes, count, 0);
+}
+
+static struct lone_value *lone_intern_c_string(struct lone_lisp *lone, char *c_string)
+{
+	/* c strings given to the interpreter are never deallocated */
+	return lone_intern_bytes(lone, (unsigned char *) c_string, lone_c_string_length(c_string), 1);
+}
+
+/* ╭─────────────────────────┨ LONE LISP READER ┠───────────────────────────╮
+   │                                                                        │
+   │    The reader's job is to transform input into lone lisp values.       │
+   │    It accomplishes the task by reading input from a given file         │
+   │    descriptor and then lexing and parsing the results.                 │
+   │                                                                        │
+   │    Regular files are mapped into memory whole and lexed in place.      │
+   │    The mapping is never removed so the symbols read from it simply     │
+   │    borrow its bytes instead of copying them. Texts are still copied    │
+   │    so that they end in a null byte like C strings. Other files such    │
+   │    as pipes are read into a buffer which doubles when full.            │
+   │                                                                        │
+   │    Readers without a file descriptor are fed input by lisp code        │
+   │    instead. They never block: when they run out of input midway        │
+   │    through a value, they rewind to its beginning and report that       │
+   │    more input is needed. Reading resumes once more has been fed.       │
+   │                                                                        │
+   │    The lexer or tokenizer transforms a linear stream of characters     │
+   │    into a linear stream of tokens suitable for parser consumption.     │
+   │    This gets rid of insignificant whitespace and reduces the size      │
+   │    of the parser's input significantly.                                │
+   │                                                                        │
+   │    It consists of an input buffer, its current position in it          │
+   │    as well as two functions:                                           │
+   │                                                                        │
+   │        ◦ peek(k) which returns the character at i+k                    │
+   │        ◦ consume(k) which advances i by k positions                    │
+   │                                                                        │
+   │    The parser transforms a linear sequence of tokens into a nested     │
+   │    sequence of lisp objects suitable for evaluation.                   │
+   │    Its main task is to match nested structures such as lists.          │
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
+#define LONE_BUFFER_SIZE 4096
+
 struct lone_reader {
 	int file_descriptor;
 	struct {
@@ -854,41 +2167,87 @@ struct lone_reader {
 			size_t write;
 		} position;
 	} buffer;
+	int mapped;
+	int finished;    /* of fed readers: no more input will be fed */
+	int incomplete;  /* of fed readers: input ran out while reading */
 	int error;
 };
 
+static int lone_reader_map(struct lone_reader *reader, int file_descriptor)
+{
+	long offset, size;
+	void *mapping;
+
+	/* only regular files can be sought, pipes and terminals fail with ESPIPE */
+	offset = linux_lseek(file_descriptor, 0, SEEK_CUR);
+	if (linux_is_error(offset)) { return 0; }
+	size = linux_lseek(file_descriptor, 0, SEEK_END);
+	if (linux_is_error(size)) { return 0; }
+	linux_lseek(file_descriptor, offset, SEEK_SET);
+	if (size <= offset) { return 0; }
+
+	mapping = linux_mmap(0, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+	if (linux_is_error((long) mapping)) { return 0; }
+
+	/* the input starts at the current offset of the file */
+	reader->buffer.bytes.pointer = (unsigned char *) mapping;
+	reader->buffer.bytes.count = size;
+	reader->buffer.position.read = offset;
+	reader->buffer.position.write = size;
+	reader->mapped = 1;
+	return 1;
+}
+
 static void lone_reader_initialize(struct lone_lisp *lone, struct lone_reader *reader, size_t buffer_size, int file_descriptor)
 {
 	reader->file_descriptor = file_descriptor;
+	reader->mapped = 0;
+	reader->finished = 0;
+	reader->incomplete = 0;
+	reader->error = 0;
+
+	if (lone_reader_map(reader, file_descriptor)) { return; }
+
 	reader->buffer.bytes.count = buffer_size;
 	reader->buffer.bytes.pointer = lone_allocate(lone, buffer_size);
 	reader->buffer.position.read = 0;
 	reader->buffer.position.write = 0;
-	reader->error = 0;
 }
 
 static size_t lone_reader_fill_buffer(struct lone_lisp *lone, struct lone_reader *reader)
 {
 	unsigned char *buffer = reader->buffer.bytes.pointer;
-	size_t size = reader->buffer.bytes.count, position = reader->buffer.position.write,
-	       allocated = size, bytes_read = 0, total_read = 0;
+	size_t position = reader->buffer.position.write,
+	       allocated = reader->buffer.bytes.count, bytes_read = 0, total_read = 0;
 	ssize_t read_result = 0;
 
+	/* mapped files are entirely in memory already */
+	if (reader->mapped) { return 0; }
+
+	/* fed readers must wait for more input */
+	if (reader->file_descriptor < 0) {
+		if (!reader->finished) { reader->incomplete = 1; }
+		return 0;
+	}
+
 	while (1) {
-		read_result = linux_read(reader->file_descriptor, buffer + position, size);
+		if (position == allocated) {
+			/* geometric growth so that copying the buffer costs constant amortized time */
+			allocated *= 2;
+			buffer = lone_reallocate(lone, buffer, allocated);
+		}
+
+		read_result = linux_read(reader->file_descriptor, buffer + position, allocated - position);
 
 		if (read_result < 0) {
-			linux_exit(-1);
+			lone_exit(lone, -1);
 		}
 
 		bytes_read = (size_t) read_result;
 		total_read += bytes_read;
 		position += bytes_read;
 
-		if (bytes_read == size) {
-			allocated += size;
-			buffer = lone_reallocate(lone, buffer, allocated);
-		} else {
+		if (position < allocated) {
 			break;
 		}
 	}
@@ -899,6 +2258,42 @@ static size_t lone_reader_fill_buffer(struct lone_lisp *lone, struct lone_reader
 	return total_read;
 }
 
+static void lone_reader_feed(struct lone_lisp *lone, struct lone_reader *reader, unsigned char *bytes, size_t count)
+{
+	size_t pending = reader->buffer.position.write - reader->buffer.position.read,
+	       allocated = reader->buffer.bytes.count;
+
+	/* consumed input is discarded since reading never rewinds past it */
+	lone_memory_move(reader->buffer.bytes.pointer + reader->buffer.position.read, reader->buffer.bytes.pointer, pending);
+	reader->buffer.position.read = 0;
+	reader->buffer.position.write = pending;
+
+	if (pending + count > allocated) {
+		while (pending + count > allocated) { allocated *= 2; }
+		reader->buffer.bytes.pointer = lone_reallocate(lone, reader->buffer.bytes.pointer, allocated);
+		reader->buffer.bytes.count = allocated;
+	}
+
+	lone_memory_move(bytes, reader->buffer.bytes.pointer + pending, count);
+	reader->buffer.position.write += count;
+}
+
+static struct lone_value *lone_reader_create(struct lone_lisp *lone, size_t buffer_size, int file_descriptor)
+{
+	struct lone_value *value = lone_value_create(lone);
+	value->type = LONE_READER;
+	value->reader = lone_allocate(lone, sizeof(*value->reader));
+	lone_reader_initialize(lone, value->reader, buffer_size, file_descriptor);
+	return value;
+}
+
+static void lone_reader_finalize(struct lone_lisp *lone, struct lone_reader *reader)
+{
+	/* mappings are never removed, symbols may be borrowing them */
+	if (!reader->mapped) { lone_deallocate(lone, reader->buffer.bytes.pointer); }
+	lone_deallocate(lone, reader);
+}
+
 /* ╭────────────────────────────────────────────────────────────────────────╮
    │                                                                        │
    │    The peek(k) function returns the k-th element from the input        │
@@ -916,7 +2311,7 @@ static unsigned char *lone_reader_peek_k(struct lone_lisp *lone, struct lone_rea
 		// we'd overrun the buffer because there's not enough input
 		// fill it up by reading more first
 		bytes_read = lone_reader_fill_buffer(lone, reader);
-		if (bytes_read <= k) {
+		if (bytes_read == 0 || read_position + k >= reader->buffer.position.write) {
 			// wanted at least k bytes but got less
 			return 0;
 		}
@@ -946,24 +2341,145 @@ static void lone_reader_consume(struct lone_reader *reader)
 	lone_reader_consume_k(reader, 1);
 }
 
-static int lone_reader_match_byte(unsigned char byte, unsigned char target)
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Every byte belongs to a set of character classes which are          │
+   │    looked up in a table instead of being compared one at a time.       │
+   │    The lexer scans runs of bytes of the same class directly out        │
+   │    of the buffer and only refills it when the run reaches its end.     │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+enum lone_character_class {
+	LONE_CHARACTER_SPACE   = 1 << 0,
+	LONE_CHARACTER_CLOSING = 1 << 1,
+	LONE_CHARACTER_OPENING = 1 << 2,
+	LONE_CHARACTER_DIGIT   = 1 << 3,
+	LONE_CHARACTER_SIGN    = 1 << 4,
+	LONE_CHARACTER_QUOTE   = 1 << 5,
+
+	/* tokens must be followed by one of these */
+	LONE_CHARACTER_DELIMITER = LONE_CHARACTER_SPACE | LONE_CHARACTER_CLOSING,
+};
+
+static const unsigned char lone_character_classes[256] = {
+	[' ']  = LONE_CHARACTER_SPACE,
+	['\t'] = LONE_CHARACTER_SPACE,
+	['\n'] = LONE_CHARACTER_SPACE,
+
+	[')'] = LONE_CHARACTER_CLOSING,
+	[']'] = LONE_CHARACTER_CLOSING,
+	['}'] = LONE_CHARACTER_CLOSING,
+
+	['(']  = LONE_CHARACTER_OPENING,
+	['[']  = LONE_CHARACTER_OPENING,
+	['{']  = LONE_CHARACTER_OPENING,
+	['\''] = LONE_CHARACTER_OPENING,
+
+	['0'] = LONE_CHARACTER_DIGIT,
+	['1'] = LONE_CHARACTER_DIGIT,
+	['2'] = LONE_CHARACTER_DIGIT,
+	['3'] = LONE_CHARACTER_DIGIT,
+	['4'] = LONE_CHARACTER_DIGIT,
+	['5'] = LONE_CHARACTER_DIGIT,
+	['6'] = LONE_CHARACTER_DIGIT,
+	['7'] = LONE_CHARACTER_DIGIT,
+	['8'] = LONE_CHARACTER_DIGIT,
+	['9'] = LONE_CHARACTER_DIGIT,
+
+	['+'] = LONE_CHARACTER_SIGN,
+	['-'] = LONE_CHARACTER_SIGN,
+
+	['"'] = LONE_CHARACTER_QUOTE,
+};
+
+static int lone_reader_match_class(unsigned char byte, unsigned char classes)
+{
+	return (lone_character_classes[byte] & classes) != 0;
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Consumes bytes for as long as their membership in the given         │
+   │    classes is as expected and returns how many were consumed.          │
+   │    Stops at the first byte that does not match or at end of input.     │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static size_t lone_reader_scan(struct lone_lisp *lone, struct lone_reader *reader, unsigned char classes, int member)
 {
-	if (target == ' ') {
-		switch (byte) {
-		case ' ':
-		case '\t':
-		case '\n':
-			return 1;
-		default:
-			return 0;
+	size_t start = reader->buffer.position.read, position = start, end;
+	unsigned char *bytes;
+
+	while (1) {
+		bytes = reader->buffer.bytes.pointer;
+		end = reader->buffer.position.write;
+
+		while (position < end && lone_reader_match_class(bytes[position], classes) == member) {
+			++position;
 		}
-	} else if (target == ')' || target == ']' || target == '}') {
-		return byte == ')' || byte == ']' || byte == '}';
-	} else if (target >= '0' && target <= '9') {
-		return byte >= '0' && byte <= '9';
-	} else {
-		return byte == target;
+
+		/* the run continues past the buffered input */
+		if (position < end || lone_reader_fill_buffer(lone, reader) == 0) { break; }
+	}
+
+	reader->buffer.position.read = position;
+	return position - start;
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Consumes bytes until the target byte is found at the current        │
+   │    position or input ends, returning how many bytes were consumed.     │
+   │    Searches whole machine words at a time: xoring a word with the      │
+   │    target byte repeated across it zeroes the matching bytes and        │
+   │    the lowest zero byte can be found with a few arithmetic tricks.     │
+   │                                                                        │
+   │        found = (word - 0x0101…01) & ~word & 0x8080…80                  │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+typedef unsigned long __attribute__((may_alias)) lone_word;
+
+static size_t lone_reader_find(struct lone_lisp *lone, struct lone_reader *reader, unsigned char target)
+{
+	size_t start = reader->buffer.position.read, position = start, end;
+	lone_word ones = ~0UL / 0xFF, highs = ones << 7, pattern = ones * target, word, found;
+	unsigned char *bytes;
+
+	while (1) {
+		bytes = reader->buffer.bytes.pointer;
+		end = reader->buffer.position.write;
+
+		/* align to a word boundary so that loads never cross pages */
+		while (position < end && ((unsigned long) (bytes + position) % sizeof(word)) != 0) {
+			if (bytes[position] == target) { goto found; }
+			++position;
+		}
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		while (position + sizeof(word) <= end) {
+			word = *((lone_word *) (bytes + position)) ^ pattern;
+			found = (word - ones) & ~word & highs;
+
+			if (found) {
+				/* borrows only propagate upwards so the lowest bit is exact */
+				position += __builtin_ctzl(found) / 8;
+				goto found;
+			}
+
+			position += sizeof(word);
+		}
+#endif
+
+		while (position < end) {
+			if (bytes[position] == target) { goto found; }
+			++position;
+		}
+
+		if (lone_reader_fill_buffer(lone, reader) == 0) { break; }
 	}
+
+found:
+	reader->buffer.position.read = position;
+	return position - start;
 }
 
 /* ╭────────────────────────────────────────────────────────────────────────╮
@@ -977,28 +2493,22 @@ static struct lone_value *lone_reader_consume_number(struct lone_lisp *lone, str
 {
 	unsigned char *current, *start = lone_reader_peek(lone, reader);
 	if (!start) { return 0; }
-	size_t end = 0;
+	size_t digits, end = 0, offset = reader->buffer.position.read;
 
-	switch (*start) {
-	case '+': case '-':
+	if (lone_reader_match_class(*start, LONE_CHARACTER_SIGN)) {
 		lone_reader_consume(reader);
 		++end;
-		break;
-	default:
-		break;
 	}
 
-	if ((current = lone_reader_peek(lone, reader)) && lone_reader_match_byte(*current, '1')) {
-		lone_reader_consume(reader);
-		++end;
-	} else { return 0; }
+	digits = lone_reader_scan(lone, reader, LONE_CHARACTER_DIGIT, 1);
+	if (!digits) { return 0; }
+	end += digits;
 
-	while ((current = lone_reader_peek(lone, reader)) && lone_reader_match_byte(*current, '1')) {
-		lone_reader_consume(reader);
-		++end;
-	}
+	current = lone_reader_peek(lone, reader);
+	if (current && !lone_reader_match_class(*current, LONE_CHARACTER_DELIMITER)) { return 0; }
 
-	if (current && !lone_reader_match_byte(*current, ')') && !lone_reader_match_byte(*current, ' ')) { return 0; }
+	/* the buffer may have moved while looking ahead */
+	start = reader->buffer.bytes.pointer + offset;
 
 	return lone_integer_parse(lone, start, end);
 }
@@ -1012,16 +2522,16 @@ static struct lone_value *lone_reader_consume_number(struct lone_lisp *lone, str
    ╰────────────────────────────────────────────────────────────────────────╯ */
 static struct lone_value *lone_reader_consume_symbol(struct lone_lisp *lone, struct lone_reader *reader)
 {
-	unsigned char *current, *start = lone_reader_peek(lone, reader);
-	if (!start) { return 0; }
-	size_t end = 0;
+	unsigned char *start;
+	size_t end, offset = reader->buffer.position.read;
 
-	while ((current = lone_reader_peek(lone, reader)) && !lone_reader_match_byte(*current, ')') && !lone_reader_match_byte(*current, ' ')) {
-		lone_reader_consume(reader);
-		++end;
-	}
+	end = lone_reader_scan(lone, reader, LONE_CHARACTER_DELIMITER, 0);
+	if (!end) { return 0; }
+
+	/* the buffer may have moved while looking ahead */
+	start = reader->buffer.bytes.pointer + offset;
 
-	return lone_intern(lone, start, end);
+	return lone_intern_bytes(lone, start, end, reader->mapped);
 }
 
 /* ╭────────────────────────────────────────────────────────────────────────╮
@@ -1033,25 +2543,28 @@ static struct lone_value *lone_reader_consume_symbol(struct lone_lisp *lone, str
    ╰────────────────────────────────────────────────────────────────────────╯ */
 static struct lone_value *lone_reader_consume_text(struct lone_lisp *lone, struct lone_reader *reader)
 {
-	size_t end = 0;
+	size_t end, offset;
 	unsigned char *current, *start = lone_reader_peek(lone, reader);
 	if (!start || *start != '"') { return 0; }
 
 	// skip leading "
-	++start;
 	lone_reader_consume(reader);
+	offset = reader->buffer.position.read;
 
-	while ((current = lone_reader_peek(lone, reader)) && *current != '"') {
-		lone_reader_consume(reader);
-		++end;
-	}
+	end = lone_reader_find(lone, reader, '"');
+
+	if (!lone_reader_peek(lone, reader)) { /* unterminated text */ return 0; }
 
 	// skip trailing "
-	++current;
 	lone_reader_consume(reader);
 
-	if (!lone_reader_match_byte(*current, ')') && !lone_reader_match_byte(*current, ' ')) { return 0; }
+	current = lone_reader_peek(lone, reader);
+	if (current && !lone_reader_match_class(*current, LONE_CHARACTER_DELIMITER)) { return 0; }
 
+	/* the buffer may have moved while looking ahead */
+	start = reader->buffer.bytes.pointer + offset;
+
+	/* texts are copied even from mapped files since they must end in a null byte */
 	return lone_text_create(lone, start, end);
 }
 
@@ -1069,14 +2582,10 @@ static struct lone_value *lone_reader_consume_character(struct lone_lisp *lone,
 	unsigned char *bracket = lone_reader_peek(lone, reader);
 	if (!bracket) { return 0; }
 
-	switch (*bracket) {
-	case '(': case ')':
-	case '[': case ']':
-	case '{': case '}':
-	case '\'':
+	if (lone_reader_match_class(*bracket, LONE_CHARACTER_OPENING | LONE_CHARACTER_CLOSING)) {
 		lone_reader_consume(reader);
 		return lone_intern(lone, bracket, 1);
-	default:
+	} else {
 		return 0;
 	}
 }
@@ -1108,31 +2617,28 @@ static struct lone_value *lone_lex(struct lone_lisp *lone, struct lone_reader *r
 	unsigned char *c;
 
 	while ((c = lone_reader_peek(lone, reader))) {
-		if (lone_reader_match_byte(*c, ' ')) {
-			lone_reader_consume(reader);
+		if (lone_reader_match_class(*c, LONE_CHARACTER_SPACE)) {
+			lone_reader_scan(lone, reader, LONE_CHARACTER_SPACE, 1);
 			continue;
 		} else {
 			unsigned char *c1;
 
-			switch (*c) {
-			case '+': case '-':
-				if ((c1 = lone_reader_peek_k(lone, reader, 1)) && lone_reader_match_byte(*c1, '1')) {
+			switch (lone_character_classes[*c]) {
+			case LONE_CHARACTER_SIGN:
+				if ((c1 = lone_reader_peek_k(lone, reader, 1)) && lone_reader_match_class(*c1, LONE_CHARACTER_DIGIT)) {
 					token = lone_reader_consume_number(lone, reader);
 				} else {
 					token = lone_reader_consume_symbol(lone, reader);
 				}
 				break;
-			case '0': case '1': case '2': case '3': case '4':
-			case '5': case '6': case '7': case '8': case '9':
+			case LONE_CHARACTER_DIGIT:
 				token = lone_reader_consume_number(lone, reader);
 				break;
-			case '"':
+			case LONE_CHARACTER_QUOTE:
 				token = lone_reader_consume_text(lone, reader);
 				break;
-			case '(': case ')':
-			case '[': case ']':
-			case '{': case '}':
-			case '\'':
+			case LONE_CHARACTER_OPENING:
+			case LONE_CHARACTER_CLOSING:
 				token = lone_reader_consume_character(lone, reader);
 				break;
 			default:
@@ -1151,7 +2657,9 @@ static struct lone_value *lone_lex(struct lone_lisp *lone, struct lone_reader *r
 	return token;
 
 lex_failed:
-	linux_exit(-1);
+	/* the token may be valid once more input is fed */
+	if (reader->incomplete) { return 0; }
+	lone_exit(lone, -1);
 }
 
 static struct lone_value *lone_parse(struct lone_lisp *, struct lone_reader *, struct lone_value *);
@@ -1159,20 +2667,19 @@ static struct lone_value *lone_parse(struct lone_lisp *, struct lone_reader *, s
 static struct lone_value *lone_parse_vector(struct lone_lisp *lone, struct lone_reader *reader)
 {
 	struct lone_value *vector = lone_vector_create(lone, 32), *value;
-	size_t i = 0;
 
 	while (1) {
 		value = lone_lex(lone, reader);
 
 		if (!value) { /* end of input */ reader->error = 1; return 0; }
-		if (value->type == LONE_SYMBOL && *value->bytes.pointer == ']') {
+		if (lone_type_of(value) == LONE_SYMBOL && *value->bytes.pointer == ']') {
 			/* complete vector: [], [ x ], [ x y ] */
 			break;
 		}
 
 		value = lone_parse(lone, reader, value);
 
-		lone_vector_set(lone, vector, lone_integer_create(lone, i++), value);
+		lone_vector_push(lone, vector, value);
 	}
 
 	return vector;
@@ -1185,7 +2692,7 @@ static struct lone_value *lone_parse_table(struct lone_lisp *lone, struct lone_r
 		key = lone_lex(lone, reader);
 
 		if (!key) { /* end of input */ reader->error = 1; return 0; }
-		if (key->type == LONE_SYMBOL && *key->bytes.pointer == '}') {
+		if (lone_type_of(key) == LONE_SYMBOL && *key->bytes.pointer == '}') {
 			/* complete table: {}, { x y } */
 			break;
 		}
@@ -1195,7 +2702,7 @@ static struct lone_value *lone_parse_table(struct lone_lisp *lone, struct lone_r
 		value = lone_lex(lone, reader);
 
 		if (!value) { /* end of input */ reader->error = 1; return 0; }
-		if (value->type == LONE_SYMBOL && *value->bytes.pointer == '}') {
+		if (lone_type_of(value) == LONE_SYMBOL && *value->bytes.pointer == '}') {
 			/* incomplete table: { x }, { x y z } */
 			reader->error = 1;
 			return 0;
@@ -1211,21 +2718,20 @@ static struct lone_value *lone_parse_table(struct lone_lisp *lone, struct lone_r
 
 static struct lone_value *lone_parse_list(struct lone_lisp *lone, struct lone_reader *reader)
 {
-	struct lone_value *list = lone_list_create_nil(lone), *first = list, *next;
+	struct lone_value *first = 0, *last = 0, *next;
 
 	while (1) {
 		next = lone_lex(lone, reader);
 		if (!next) { reader->error = 1; return 0; }
 
-		if (next->type == LONE_SYMBOL && *next->bytes.pointer == ')') {
+		if (lone_type_of(next) == LONE_SYMBOL && *next->bytes.pointer == ')') {
 			break;
 		}
 
-		lone_list_set(list, lone_parse(lone, reader, next));
-		list = lone_list_append(list, lone_list_create_nil(lone));
+		last = lone_list_build(lone, &first, last, lone_parse(lone, reader, next));
 	}
 
-	return first;
+	return first? first : lone_list_create_nil(lone);
 }
 
 static struct lone_value *lone_parse_quote(struct lone_lisp *lone, struct lone_reader *reader)
@@ -1243,7 +2749,7 @@ static struct lone_value *lone_parse(struct lone_lisp *lone, struct lone_reader
 
 	// lexer has already parsed atoms
 	// parser deals with nested structures
-	switch (token->type) {
+	switch (lone_type_of(token)) {
 	case LONE_SYMBOL:
 		switch (*token->bytes.pointer) {
 		case '(':
@@ -1270,17 +2776,31 @@ static struct lone_value *lone_parse(struct lone_lisp *lone, struct lone_reader
 	case LONE_TABLE:
 	case LONE_BYTES:
 	case LONE_POINTER:
+	case LONE_READER:
 		/* unexpected value type from lexer */
 		goto parse_failed;
 	}
 
 parse_failed:
-	linux_exit(-1);
+	lone_exit(lone, -1);
 }
 
 static struct lone_value *lone_read(struct lone_lisp *lone, struct lone_reader *reader)
 {
-	return lone_parse(lone, reader, lone_lex(lone, reader));
+	size_t start = reader->buffer.position.read;
+	struct lone_value *value;
+
+	reader->incomplete = 0;
+	value = lone_parse(lone, reader, lone_lex(lone, reader));
+
+	if (reader->incomplete) {
+		/* the value will be read again from the start once more input is fed */
+		reader->buffer.position.read = start;
+		reader->error = 0;
+		return 0;
+	}
+
+	return value;
 }
 
 /* ╭────────────────────────┨ LONE LISP EVALUATOR ┠─────────────────────────╮
@@ -1290,6 +2810,7 @@ static struct lone_value *lone_read(struct lone_lisp *lone, struct lone_reader *
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
 static struct lone_value *lone_evaluate(struct lone_lisp *, struct lone_value *, struct lone_value *);
+static inline struct lone_value *lone_evaluate_first(struct lone_lisp *, struct lone_value *, struct lone_value *);
 
 static struct lone_value *lone_evaluate_module(struct lone_lisp *lone, struct lone_value *module, struct lone_value *value)
 {
@@ -1302,7 +2823,7 @@ static struct lone_value *lone_evaluate_form_index(struct lone_lisp *lone, struc
 	void (*set)(struct lone_lisp *, struct lone_value *, struct lone_value *, struct lone_value *);
 	struct lone_value *key, *value;
 
-	switch (collection->type) {
+	switch (lone_type_of(collection)) {
 	case LONE_VECTOR:
 		get = lone_vector_get;
 		set = lone_vector_set;
@@ -1312,10 +2833,10 @@ static struct lone_value *lone_evaluate_form_index(struct lone_lisp *lone, struc
 		set = lone_table_set;
 		break;
 	default:
-		linux_exit(-1);
+		lone_exit(lone, -1);
 	}
 
-	if (lone_is_nil(arguments)) { /* need at least the key: (collection) */ linux_exit(-1); }
+	if (lone_is_nil(arguments)) { /* need at least the key: (collection) */ lone_exit(lone, -1); }
 	key = lone_list_first(arguments);
 	arguments = lone_list_rest(arguments);
 	if (lone_is_nil(arguments)) {
@@ -1333,588 +2854,2303 @@ static struct lone_value *lone_evaluate_form_index(struct lone_lisp *lone, struc
 			return value;
 		} else {
 			/* too many arguments given: (collection key value extra) */
-			linux_exit(-1);
+			lone_exit(lone, -1);
 		}
 	}
 }
 
-static struct lone_value *lone_apply(struct lone_lisp *, struct lone_value *, struct lone_value *, struct lone_value *);
-static struct lone_value *lone_apply_primitive(struct lone_lisp *, struct lone_value *, struct lone_value *, struct lone_value *);
+static int lone_apply(struct lone_lisp *, struct lone_value **, struct lone_value *, struct lone_value *, struct lone_value **);
 
-static struct lone_value *lone_evaluate_form(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *list)
+static struct lone_value *lone_evaluate(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *value)
 {
-	struct lone_value *first = lone_list_first(list), *rest = lone_list_rest(list);
+	struct lone_value *applicable;
 
-	/* apply arguments to a lone value */
-	first = lone_evaluate(lone, environment, first);
-	switch (first->type) {
-	case LONE_FUNCTION:
-		return lone_apply(lone, environment, first, rest);
-	case LONE_PRIMITIVE:
-		return lone_apply_primitive(lone, environment, first, rest);
-	case LONE_VECTOR:
-	case LONE_TABLE:
-		return lone_evaluate_form_index(lone, environment, first, rest);
-	case LONE_MODULE:
-	case LONE_LIST:
-	case LONE_SYMBOL:
-	case LONE_TEXT:
-	case LONE_BYTES:
-	case LONE_INTEGER:
-	case LONE_POINTER:
-		/* first element not an applicable type */ linux_exit(-1);
+	/* applications in tail position replace the expression being evaluated */
+	while (1) {
+		if (value == 0) { return 0; }
+		if (lone_is_nil(value)) { return value; }
+
+		switch (lone_type_of(value)) {
+		case LONE_LIST:
+			applicable = lone_evaluate_first(lone, environment, value);
+			if (!lone_apply(lone, &environment, applicable, lone_list_rest(value), &value)) { return value; }
+			break;
+		case LONE_SYMBOL:
+			return lone_environment_get(lone, environment, value);
+		case LONE_MODULE:
+		case LONE_FUNCTION:
+		case LONE_PRIMITIVE:
+		case LONE_VECTOR:
+		case LONE_TABLE:
+		case LONE_INTEGER:
+		case LONE_POINTER:
+		case LONE_READER:
+		case LONE_BYTES:
+		case LONE_TEXT:
+			return value;
+		}
 	}
 }
 
-static struct lone_value *lone_evaluate(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *value)
+static struct lone_value *lone_evaluate_application(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *applicable, struct lone_value *arguments)
 {
-	if (value == 0) { return 0; }
-	if (lone_is_nil(value)) { return value; }
-
-	switch (value->type) {
-	case LONE_LIST:
-		return lone_evaluate_form(lone, environment, value);
-	case LONE_SYMBOL:
-		return lone_table_get(lone, environment, value);
-	case LONE_MODULE:
-	case LONE_FUNCTION:
-	case LONE_PRIMITIVE:
-	case LONE_VECTOR:
-	case LONE_TABLE:
-	case LONE_INTEGER:
-	case LONE_POINTER:
-	case LONE_BYTES:
-	case LONE_TEXT:
-		return value;
+	struct lone_value *value;
+	if (lone_apply(lone, &environment, applicable, arguments, &value)) { value = lone_evaluate(lone, environment, value); }
+	return value;
+}
+
+static inline struct lone_value *lone_evaluate_first(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *list)
+{
+	struct lone_value *value = lone_list_first(list);
+
+	if (value && lone_type_of(value) == LONE_SYMBOL && lone_is_frame(environment)) {
+		return lone_evaluate_reference(lone, environment, list);
 	}
+
+	return lone_evaluate(lone, environment, value);
 }
 
 static struct lone_value *lone_evaluate_all(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *list)
 {
-	struct lone_value *evaluated = lone_list_create_nil(lone), *head;
+	struct lone_value *first = 0, *last = 0;
 
-	for (head = evaluated; !lone_is_nil(list); list = lone_list_rest(list)) {
-		lone_list_set(head, lone_evaluate(lone, environment, lone_list_first(list)));
-		head = lone_list_append(head, lone_list_create_nil(lone));
+	for (/* list */; !lone_is_nil(list); list = lone_list_rest(list)) {
+		last = lone_list_build(lone, &first, last, lone_evaluate_first(lone, environment, list));
 	}
 
-	return evaluated;
+	return first? first : lone_list_create_nil(lone);
 }
 
-static struct lone_value *lone_apply(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *function, struct lone_value *arguments)
+/* ╭─────────────────────────┨ LONE LISP PROFILER ┠─────────────────────────╮
+   │                                                                        │
+   │    The profiler builds a tree of the functions and primitives that     │
+   │    were called, with one profile for each distinct path of calls.      │
+   │    Every profile counts its calls, the clock ticks spent in it but     │
+   │    not in its callees and the bytes allocated directly by its code.    │
+   │    Ticks are charged to the current profile whenever it changes.       │
+   │                                                                        │
+   │    It is enabled by the LONE_PROFILE environment variable or by the    │
+   │    profile primitive. The paths are reported when lone exits, in the   │
+   │    folded stacks format of flamegraph tools, sorted by the chosen      │
+   │    metric: time, calls or allocations.                                 │
+   │                                                                        │
+   │        LONE_PROFILE=time lone < program.ln 2> program.folded           │
+   │        flamegraph.pl program.folded > program.svg                      │
+   │                                                                        │
+   │    https://github.com/brendangregg/FlameGraph                          │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static void lone_mark_profiles(struct lone_lisp *lone)
 {
-	struct lone_value *new_environment = lone_table_create(lone, 16, function->function.environment),
-	                  *names = function->function.arguments, *code = function->function.code,
-	                  *value;
+	struct lone_profile *profile;
 
-	if (function->function.flags.evaluate_arguments) { arguments = lone_evaluate_all(lone, environment, arguments); }
-
-	if (function->function.flags.variable_arguments) {
-		if (lone_is_nil(names) || !lone_is_nil(lone_list_rest(names))) {
-			/* must have exactly one argument: the list of arguments */
-			linux_exit(-1);
-		}
+	for (profile = lone->profiler.all; profile; profile = profile->next) {
+		lone_mark_value(lone, profile->function);
+		lone_mark_value(lone, profile->name);
+	}
+}
 
-		lone_table_set(lone, new_environment, lone_list_first(names), arguments);
-	} else {
-		while (1) {
-			if (lone_is_nil(names) != lone_is_nil(arguments)) {
-				/* argument number mismatch: ((lambda (x) x) 10 20), ((lambda (x y) y) 10) */
-				linux_exit(-1);
-			} else if (lone_is_nil(names) && lone_is_nil(arguments)) {
-				break;
-			}
+static struct lone_profile *lone_profile_create(struct lone_lisp *lone, struct lone_profile *parent, struct lone_value *function)
+{
+	struct lone_profile *profile = lone_allocate(lone, sizeof(*profile));
+
+	profile->function = function;
+	profile->name = 0;
+	profile->parent = parent;
+	profile->children = 0;
+	profile->sibling = parent? parent->children : 0;
+	if (parent) { parent->children = profile; }
+	profile->next = lone->profiler.all;
+	lone->profiler.all = profile;
+	++lone->profiler.count;
+	profile->calls = profile->ticks = profile->bytes = 0;
+
+	return profile;
+}
 
-			lone_table_set(lone, new_environment, lone_list_first(names), lone_list_first(arguments));
+static void lone_profile_charge(struct lone_lisp *lone)
+{
+	unsigned long now = clock_ticks();
+	lone->profiler.current->ticks += now - lone->profiler.last;
+	lone->profiler.last = now;
+}
 
-			names = lone_list_rest(names);
-			arguments = lone_list_rest(arguments);
-		}
+static void lone_profile_start(struct lone_lisp *lone, enum lone_profile_metric metric)
+{
+	if (!lone->profiler.root) {
+		lone->profiler.root = lone->profiler.current = lone_profile_create(lone, 0, 0);
 	}
 
-	do {
-		value = lone_evaluate(lone, new_environment, lone_list_first(code));
-	} while (!lone_is_nil(code = lone_list_rest(code)));
+	lone->profiler.metric = metric;
+	lone->profiler.last = clock_ticks();
+	lone->profiler.enabled = 1;
+}
+
+static void lone_profile_stop(struct lone_lisp *lone)
+{
+	if (!lone->profiler.enabled) { return; }
+	lone_profile_charge(lone);
+	lone->profiler.enabled = 0;
+}
+
+static void lone_profile_enter(struct lone_lisp *lone, struct lone_value *function)
+{
+	struct lone_profile *parent = lone->profiler.current, **link, *profile;
 
-	if (function->function.flags.evaluate_result) { value = lone_evaluate(lone, environment, value); }
+	lone_profile_charge(lone);
 
-	return value;
+	/* recently called children are moved to the front so they are found quickly */
+	for (link = &parent->children; *link && (*link)->function != function; link = &(*link)->sibling);
+
+	if (*link) {
+		profile = *link;
+		*link = profile->sibling;
+		profile->sibling = parent->children;
+		parent->children = profile;
+	} else {
+		profile = lone_profile_create(lone, parent, function);
+	}
+
+	++profile->calls;
+	lone->profiler.current = profile;
+
+	/* the time spent profiling is not charged to anything */
+	lone->profiler.last = clock_ticks();
 }
 
-static struct lone_value *lone_apply_primitive(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *primitive, struct lone_value *arguments)
+static void lone_profile_exit(struct lone_lisp *lone)
 {
-	struct lone_value *result;
-	if (primitive->primitive.flags.evaluate_arguments) { arguments = lone_evaluate_all(lone, environment, arguments); }
-	result = primitive->primitive.function(lone, primitive->primitive.closure, environment, arguments);
-	if (primitive->primitive.flags.evaluate_result) { result = lone_evaluate(lone, environment, result); }
-	return result;
+	lone_profile_charge(lone);
+	lone->profiler.current = lone->profiler.current->parent;
 }
 
-/* ╭─────────────────────────┨ LONE LISP PRINTER ┠──────────────────────────╮
+/* ╭────────────────────────┨ LONE LISP TAIL CALLS ┠────────────────────────╮
    │                                                                        │
-   │    Transforms lone lisp objects into text in order to write it out.    │
+   │    Applications do not evaluate expressions in tail position. They     │
+   │    return them instead, along with the environment they must be        │
+   │    evaluated in, and a nonzero value that tells the caller to do so.   │
+   │    The evaluator then loops instead of nesting another evaluation,     │
+   │    so recursive loops run in constant native stack space.              │
+   │                                                                        │
+   │    Primitives whose results are evaluated return their expressions.    │
+   │    Those which evaluate expressions in some other environment, such    │
+   │    as let, also set the tail environment before they return.           │
+   │    Function calls in tail position reuse the invocation loop of the    │
+   │    function that made them.                                            │
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
-static void lone_print(struct lone_lisp *, struct lone_value *, int);
+enum lone_result {
+	LONE_RESULT_VALUE,     /* the value was computed                         */
+	LONE_RESULT_CALL,      /* the function must be called with the arguments */
+	LONE_RESULT_EVALUATE,  /* the value must be evaluated in the environment */
+};
+
+struct lone_continuation {
+	struct lone_value *environment;
+	struct lone_value *function;
+	struct lone_value *frame;
+	struct lone_value *value;
+};
+
+static struct lone_bytecode *lone_compile(struct lone_lisp *, struct lone_value *);
+static enum lone_result lone_execute(struct lone_lisp *, struct lone_value *, struct lone_bytecode *, struct lone_continuation *);
 
-static void lone_print_integer(int fd, long n)
+static struct lone_value *lone_frame_bind_values(struct lone_lisp *lone, struct lone_value *function, struct lone_value **values, size_t count)
 {
-	static char digits[DECIMAL_DIGITS_PER_LONG + 1]; /* digits, sign */
-	char *digit = digits + DECIMAL_DIGITS_PER_LONG;  /* work backwards */
-	size_t count = 0;
-	int is_negative;
+	struct lone_value *names = function->function.arguments, *frame, *list;
+	size_t i;
 
-	if (n < 0) {
-		is_negative = 1;
-		n *= -1;
+	if (function->flags.variable_arguments) {
+		if (lone_is_nil(names) || !lone_is_nil(lone_list_rest(names))) {
+			/* must have exactly one argument: the list of arguments */
+			lone_exit(lone, -1);
+		}
+
+		/* only functions with variable arguments need an argument list */
+		list = lone_list_from_values(lone, values, count);
+		frame = lone_frame_create(lone, function, 1);
+		*lone_frame_slot(frame, 0) = list;
 	} else {
-		is_negative = 0;
-	}
+		if (lone_list_count(names) != count) {
+			/* argument number mismatch: ((lambda (x) x) 10 20), ((lambda (x y) y) 10) */
+			lone_exit(lone, -1);
+		}
 
-	do {
-		*--digit = '0' + (n % 10);
-		n /= 10;
-		++count;
-	} while (n > 0);
+		frame = lone_frame_create(lone, function, count);
 
-	if (is_negative) {
-		*--digit = '-';
-		++count;
+		/* recycled frames are remembered when taken so no write barrier is needed */
+		for (i = 0; i < count; ++i) {
+			*lone_frame_slot(frame, i) = values[i];
+		}
 	}
 
-	linux_write(fd, digit, count);
+	return frame;
 }
 
-static void lone_print_bytes(struct lone_lisp *lone, struct lone_value *bytes, int fd)
+static struct lone_value *lone_frame_bind(struct lone_lisp *lone, struct lone_value *function, struct lone_value *arguments)
 {
-	size_t count = bytes->bytes.count;
-	if (count == 0) { linux_write(fd, "bytes[]", 7); return; }
+	struct lone_value *frame;
+	size_t count, i;
 
-	static unsigned char hexadecimal[] = "0123456789ABCDEF";
-	size_t size = 2 + count * 2; // size required: "0x" + 2 characters per input byte
-	unsigned char *text = lone_allocate(lone, size);
-	unsigned char *byte = bytes->bytes.pointer;
-	size_t i;
+	if (function->flags.variable_arguments) {
+		frame = lone_frame_bind_values(lone, function, 0, 0);
+		*lone_frame_slot(frame, 0) = arguments;
+		return frame;
+	}
 
-	text[0] = '0';
-	text[1] = 'x';
+	count = lone_list_count(arguments);
+	if (count == (size_t) -1) { /* improper argument list: ((lambda (x) x) . 10) */ lone_exit(lone, -1); }
 
-	for (i = 0; i < count; ++i) {
-		unsigned char low  = (byte[i] & 0x0F) >> 0;
-		unsigned char high = (byte[i] & 0xF0) >> 4;
-		text[2 + (2 * i + 0)] = hexadecimal[high];
-		text[2 + (2 * i + 1)] = hexadecimal[low];
+	struct lone_value *values[count + 1];
+	for (i = 0; i < count; ++i, arguments = lone_list_rest(arguments)) {
+		values[i] = lone_list_first(arguments);
 	}
 
-	linux_write(fd, "bytes[", 6);
-	linux_write(fd, text, size);
-	linux_write(fd, "]", 1);
-
-	lone_deallocate(lone, text);
+	return lone_frame_bind_values(lone, function, values, count);
 }
 
-static void lone_print_list(struct lone_lisp *lone, struct lone_value *list, int fd)
+static int lone_invoke(struct lone_lisp *lone, struct lone_value **environment, struct lone_value *function, struct lone_value *frame, struct lone_value **value)
 {
-	if (list == 0 || lone_is_nil(list)) { return; }
+	struct lone_continuation continuation;
+	int profiling = lone->profiler.enabled;
 
-	struct lone_value *first = list->list.first,
-	                  *rest  = list->list.rest;
-
-	lone_print(lone, first, fd);
+	if (profiling) { lone_profile_enter(lone, function); }
 
-	if (rest->type == LONE_LIST) {
-		if (!lone_is_nil(rest)) {
-			linux_write(fd, " ", 1);
-			lone_print_list(lone, rest, fd);
+	while (1) {
+		/* functions are compiled the first time they are called */
+		if (!function->function.bytecode) { function->function.bytecode = lone_compile(lone, function); }
+
+		switch (lone_execute(lone, frame, function->function.bytecode, &continuation)) {
+		case LONE_RESULT_VALUE:
+			if (profiling) { lone_profile_exit(lone); }
+			*value = continuation.value;
+			if (!function->flags.evaluate_result) { lone_frame_recycle(lone, frame); }
+			return function->flags.evaluate_result;
+		case LONE_RESULT_CALL:
+			/* the results of the callee are evaluated in the frame of its caller */
+			if (continuation.function->flags.evaluate_result) {
+				*environment = frame;
+			} else {
+				lone_frame_recycle(lone, frame);
+			}
+			function = continuation.function;
+			frame = continuation.frame;
+			/* tail calls replace the caller in the profile too */
+			if (profiling) { lone_profile_exit(lone); lone_profile_enter(lone, function); }
+			break;
+		case LONE_RESULT_EVALUATE:
+			if (profiling) { lone_profile_exit(lone); }
+			*environment = continuation.environment;
+			*value = continuation.value;
+			return 1;
 		}
-	} else {
-		linux_write(fd, " . ", 3);
-		lone_print(lone, rest, fd);
 	}
 }
 
-static void lone_print_vector(struct lone_lisp *lone, struct lone_value *vector, int fd)
+static int lone_invoke_primitive_result(struct lone_lisp *lone, struct lone_value **environment, struct lone_value *primitive)
 {
-	size_t n = vector->vector.count, i;
-	struct lone_value **values = vector->vector.values;
-
-	if (vector->vector.count == 0) { linux_write(fd, "[]", 2); return; }
-
-	linux_write(fd, "[ ", 2);
-
-	for (i = 0; i < n; ++i) {
-		lone_print(lone, values[i], fd);
-		linux_write(fd, " ", 1);
+	if (lone->tail.environment) {
+		if (primitive->flags.evaluate_result) { *environment = lone->tail.environment; }
+		lone->tail.environment = 0;
 	}
 
-	linux_write(fd, "]", 1);
+	return primitive->flags.evaluate_result;
 }
 
-static void lone_print_table(struct lone_lisp *lone, struct lone_value *table, int fd)
+static int lone_invoke_primitive(struct lone_lisp *lone, struct lone_value **environment, struct lone_value *primitive, struct lone_value *arguments, struct lone_value **value)
 {
-	size_t n = table->table.capacity, i;
-	struct lone_table_entry *entries = table->table.entries;
+	int profiling = lone->profiler.enabled;
+	size_t count, i;
 
-	if (table->table.count == 0) { linux_write(fd, "{}", 2); return; }
-
-	linux_write(fd, "{ ", 2);
-
-	for (i = 0; i < n; ++i) {
-		struct lone_value *key   = entries[i].key,
-		                  *value = entries[i].value;
+	if (profiling) { lone_profile_enter(lone, primitive); }
 
+	if (primitive->primitive.function) {
+		*value = primitive->primitive.function(lone, primitive->primitive.closure, *environment, arguments);
+	} else {
+		count = lone_list_count(arguments);
+		if (count == (size_t) -1) { /* improper argument list: (+ . 10) */ lone_exit(lone, -1); }
 
-		if (key) {
-			lone_print(lone, key, fd);
-			linux_write(fd, " ", 1);
-			lone_print(lone, value, fd);
-			linux_write(fd, " ", 1);
+		struct lone_value *values[count + 1];
+		for (i = 0; i < count; ++i, arguments = lone_list_rest(arguments)) {
+			values[i] = lone_list_first(arguments);
 		}
+
+		*value = primitive->primitive.fast(lone, primitive->primitive.closure, *environment, count, values);
 	}
 
-	linux_write(fd, "}", 1);
+	if (profiling) { lone_profile_exit(lone); }
+
+	return lone_invoke_primitive_result(lone, environment, primitive);
 }
 
-static void lone_print_function(struct lone_lisp *lone, struct lone_value *function, int fd)
+static int lone_invoke_primitive_values(struct lone_lisp *lone, struct lone_value **environment, struct lone_value *primitive, struct lone_value **values, size_t count, struct lone_value **value)
 {
-	struct lone_value *arguments = function->function.arguments,
-	                  *code = function->function.code;
+	int profiling = lone->profiler.enabled;
 
-	linux_write(fd, "(𝛌 ", 6);
-	lone_print(lone, arguments, fd);
+	if (profiling) { lone_profile_enter(lone, primitive); }
 
-	while (!lone_is_nil(code)) {
-		linux_write(fd, "\n  ", 3);
-		lone_print(lone, lone_list_first(code), fd);
-		code = lone_list_rest(code);
+	if (primitive->primitive.fast) {
+		*value = primitive->primitive.fast(lone, primitive->primitive.closure, *environment, count, values);
+	} else {
+		*value = primitive->primitive.function(lone, primitive->primitive.closure, *environment, lone_list_from_values(lone, values, count));
 	}
 
-	linux_write(fd, ")", 1);
+	if (profiling) { lone_profile_exit(lone); }
+
+	return lone_invoke_primitive_result(lone, environment, primitive);
 }
 
-static void lone_print_hash_notation(struct lone_lisp *lone, char *descriptor, struct lone_value *value, int fd)
+static int lone_apply_evaluated(struct lone_lisp *lone, struct lone_value **environment, struct lone_value *applicable, struct lone_value *arguments, struct lone_value **value)
 {
-	linux_write(fd, "#<", 2);
-	linux_write(fd, descriptor, lone_c_string_length(descriptor));
-	linux_write(fd, " ", 1);
-	lone_print(lone, value, fd);
-	linux_write(fd, ">", 1);
+	size_t count = lone_list_count(arguments), i;
+
+	if (count == (size_t) -1) { /* improper argument list: (f . 10) */ lone_exit(lone, -1); }
+
+	/* evaluated arguments are passed in an array on the native stack */
+	struct lone_value *values[count + 1];
+	for (i = 0; i < count; ++i, arguments = lone_list_rest(arguments)) {
+		values[i] = lone_evaluate_first(lone, *environment, arguments);
+	}
+
+	return lone_type_of(applicable) == LONE_FUNCTION?
+	       lone_invoke(lone, environment, applicable, lone_frame_bind_values(lone, applicable, values, count), value) :
+	       lone_invoke_primitive_values(lone, environment, applicable, values, count, value);
 }
 
-static void lone_print(struct lone_lisp *lone, struct lone_value *value, int fd)
+static int lone_apply(struct lone_lisp *lone, struct lone_value **environment, struct lone_value *applicable, struct lone_value *arguments, struct lone_value **value)
 {
-	if (value == 0) { return; }
-	if (lone_is_nil(value)) { linux_write(fd, "nil", 3); return; }
-
-	switch (value->type) {
-	case LONE_MODULE:
-		lone_print_hash_notation(lone, "module", value->module.name, fd);
-		break;
-	case LONE_PRIMITIVE:
-		lone_print_hash_notation(lone, "primitive", value->primitive.name, fd);
-		break;
+	/* apply arguments to a lone value */
+	switch (lone_type_of(applicable)) {
 	case LONE_FUNCTION:
-		lone_print_function(lone, value, fd);
-		break;
-	case LONE_LIST:
-		linux_write(fd, "(", 1);
-		lone_print_list(lone, value, fd);
-		linux_write(fd, ")", 1);
-		break;
+		if (applicable->flags.evaluate_arguments) { return lone_apply_evaluated(lone, environment, applicable, arguments, value); }
+		return lone_invoke(lone, environment, applicable, lone_frame_bind(lone, applicable, arguments), value);
+	case LONE_PRIMITIVE:
+		if (applicable->flags.evaluate_arguments) { return lone_apply_evaluated(lone, environment, applicable, arguments, value); }
+		return lone_invoke_primitive(lone, environment, applicable, arguments, value);
 	case LONE_VECTOR:
-		lone_print_vector(lone, value, fd);
-		break;
 	case LONE_TABLE:
-		lone_print_table(lone, value, fd);
-		break;
-	case LONE_BYTES:
-		lone_print_bytes(lone, value, fd);
-		break;
+		*value = lone_evaluate_form_index(lone, *environment, applicable, arguments);
+		return 0;
+	case LONE_MODULE:
+	case LONE_LIST:
 	case LONE_SYMBOL:
-		linux_write(fd, value->bytes.pointer, value->bytes.count);
-		break;
 	case LONE_TEXT:
-		linux_write(fd, "\"", 1);
-		linux_write(fd, value->bytes.pointer, value->bytes.count);
-		linux_write(fd, "\"", 1);
-		break;
+	case LONE_BYTES:
 	case LONE_INTEGER:
 	case LONE_POINTER:
-		lone_print_integer(fd, value->integer);
-		break;
+	case LONE_READER:
+		/* first element not an applicable type */ lone_exit(lone, -1);
 	}
 }
 
-/* ╭───────────────────┨ LONE LISP PRIMITIVE FUNCTIONS ┠────────────────────╮
+/* applies already evaluated values, for primitives that call back into lisp code */
+static struct lone_value *lone_apply_values(struct lone_lisp *lone, struct lone_value *environment, struct lone_value *applicable, struct lone_value **values, size_t count)
+{
+	struct lone_value *value;
+	int pending;
+
+	if (lone_type_of(applicable) != LONE_FUNCTION && lone_type_of(applicable) != LONE_PRIMITIVE) {
+		/* not a function: (read reader 10) */ lone_exit(lone, -1);
+	}
+
+	pending = lone_type_of(applicable) == LONE_FUNCTION?
+	          lone_invoke(lone, &environment, applicable, lone_frame_bind_values(lone, applicable, values, count), &value) :
+	          lone_invoke_primitive_values(lone, &environment, applicable, values, count, &value);
+
+	return pending? lone_evaluate(lone, environment, value) : value;
+}
+
+/* ╭─────────────────────┨ LONE LISP BYTECODE COMPILER ┠────────────────────╮
    │                                                                        │
-   │    Lone lisp functions implemented in C.                               │
+   │    Function bodies are compiled into code for a stack machine the      │
+   │    first time the function is called. Instructions and operands are    │
+   │    machine words. Symbols are compiled into lexical addresses which    │
+   │    are exact since the frames above those of a function never change.  │
+   │                                                                        │
+   │    The operator of a form is only known when the form is evaluated.    │
+   │    Every form therefore begins by evaluating the operator and then     │
+   │    checks whether it evaluates its arguments. If it does not, as is    │
+   │    the case of lambda! functions and primitives such as let, the       │
+   │    form is handed to the evaluator unchanged along with the operator.  │
+   │    Forms whose operator is named if or quote are compiled inline       │
+   │    but also guarded: unless that name still refers to the primitive,   │
+   │    they are handed to the evaluator too.                               │
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
-static struct lone_value *lone_primitive_if(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
-{
-	struct lone_value *value, *consequent, *alternative = 0;
+enum lone_operation {
+	LONE_CONSTANT,         /* value               → push value                     */
+	LONE_LOCAL,            /* depth slot symbol   → push parameter                 */
+	LONE_GLOBAL,           /* depth symbol cache  → push variable from table       */
+	LONE_DISCARD,          /*                     → pop                            */
+	LONE_JUMP,             /* target              → continue at target             */
+	LONE_JUMP_IF_NIL,      /* target              → pop, continue at target if nil */
+	LONE_GUARD,            /* primitive target    → pop operator unless it is not  */
+	                       /*                       the primitive, then jump       */
+	LONE_PREPARE,          /* form target         → evaluate form unless operator  */
+	                       /*                       evaluates arguments, then jump */
+	LONE_CALL,             /* count               → pop arguments and operator,    */
+	                       /*                       push result of call            */
+	LONE_EVALUATE,         /* form                → pop operator, push result      */
+	                       /*                       of its evaluated application   */
+	LONE_TAIL_PREPARE,     /* form                → like prepare, but the form is  */
+	                       /*                       in tail position               */
+	LONE_TAIL_CALL,        /* count               → like call, in tail position    */
+	LONE_TAIL_APPLY,       /* form                → like evaluate in tail position */
+	LONE_RETURN,           /*                     → return popped value            */
+};
 
-	if (lone_is_nil(arguments)) { /* test not specified: (if) */ linux_exit(-1); }
-	value = lone_list_first(arguments);
-	arguments = lone_list_rest(arguments);
+struct lone_bytecode {
+	size_t stack;          /* maximum number of values pushed at once */
+	size_t count;          /* number of words of code                 */
+	unsigned long code[];
+};
 
-	if (lone_is_nil(arguments)) { /* consequent not specified: (if test) */ linux_exit(-1); }
-	consequent = lone_list_first(arguments);
-	arguments = lone_list_rest(arguments);
+struct lone_compiler {
+	struct lone_lisp *lone;
+	struct lone_value *function;
+	unsigned long *code;
+	size_t count, capacity;
+	size_t depth, maximum;
+};
 
-	if (!lone_is_nil(arguments)) {
-		alternative = lone_list_first(arguments);
-		arguments = lone_list_rest(arguments);
-		if (!lone_is_nil(arguments)) { /* too many values (if test consequent alternative extra) */ linux_exit(-1); }
-	}
+#define LONE_GLOBAL_UNCACHED ((unsigned long) -1)
 
-	if (!lone_is_nil(lone_evaluate(lone, environment, value))) {
-		return lone_evaluate(lone, environment, consequent);
-	} else if (alternative) {
-		return lone_evaluate(lone, environment, alternative);
+static struct lone_value *lone_primitive_if(struct lone_lisp *, struct lone_value *, struct lone_value *, struct lone_value *);
+static struct lone_value *lone_primitive_quote(struct lone_lisp *, struct lone_value *, struct lone_value *, struct lone_value *);
+
+static size_t lone_compile_emit(struct lone_compiler *compiler, unsigned long word)
+{
+	if (compiler->count >= compiler->capacity) {
+		compiler->capacity = compiler->capacity? compiler->capacity * 2 : 64;
+		compiler->code = lone_reallocate(compiler->lone, compiler->code, compiler->capacity * sizeof(*compiler->code));
 	}
 
-	return lone_list_create_nil(lone);
+	compiler->code[compiler->count] = word;
+	return compiler->count++;
 }
 
-static struct lone_value *lone_primitive_let(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+static void lone_compile_push(struct lone_compiler *compiler)
 {
-	struct lone_value *bindings, *first, *second, *rest, *value, *new_environment;
+	if (++compiler->depth > compiler->maximum) { compiler->maximum = compiler->depth; }
+}
 
-	if (lone_is_nil(arguments)) { /* no variables to bind: (let) */ linux_exit(-1); }
-	bindings = lone_list_first(arguments);
-	if (bindings->type != LONE_LIST) { /* expected list but got something else: (let 10) */ linux_exit(-1); }
+static void lone_compile_expression(struct lone_compiler *, struct lone_value *, int);
 
-	new_environment = lone_table_create(lone, 8, environment);
+static void lone_compile_reference(struct lone_compiler *compiler, struct lone_value *symbol)
+{
+	struct lone_value *current = compiler->function, *environment;
+	unsigned long depth = 0;
+	long slot;
+
+	while ((slot = lone_function_parameter_slot(current, symbol)) < 0) {
+		environment = current->function.environment;
+		++depth;
+
+		if (!environment || !lone_is_frame(environment)) {
+			lone_compile_emit(compiler, LONE_GLOBAL);
+			lone_compile_emit(compiler, depth);
+			lone_compile_emit(compiler, (unsigned long) symbol);
+			lone_compile_emit(compiler, LONE_GLOBAL_UNCACHED);
+			lone_compile_emit(compiler, 0);
+			lone_compile_push(compiler);
+			return;
+		}
 
-	while (1) {
-		if (lone_is_nil(bindings)) { break; }
-		first = lone_list_first(bindings);
-		if (first->type != LONE_SYMBOL) { /* variable names must be symbols: (let ("x")) */ linux_exit(-1); }
-		rest = lone_list_rest(bindings);
-		if (lone_is_nil(rest)) { /* incomplete variable/value list: (let (x 10 y)) */ linux_exit(-1); }
-		second = lone_list_first(rest);
-		value = lone_evaluate(lone, new_environment, second);
-		lone_table_set(lone, new_environment, first, value);
-		bindings = lone_list_rest(rest);
+		current = lone_frame_function(environment);
 	}
 
-	value = lone_list_create_nil(lone);
-
-	while (!lone_is_nil(arguments = lone_list_rest(arguments))) {
-		value = lone_evaluate(lone, new_environment, lone_list_first(arguments));
-	}
+	lone_compile_emit(compiler, LONE_LOCAL);
+	lone_compile_emit(compiler, depth);
+	lone_compile_emit(compiler, slot);
+	lone_compile_emit(compiler, (unsigned long) symbol);
+	lone_compile_push(compiler);
+}
 
-	return value;
+static inline void lone_compile_patch(struct lone_compiler *compiler, size_t operand)
+{
+	compiler->code[operand] = compiler->count;
 }
 
-static struct lone_value *lone_primitive_set(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+static size_t lone_compile_exit(struct lone_compiler *compiler, int tail)
 {
-	struct lone_value *variable, *value;
+	/* values in tail position are returned, others continue after the form */
+	if (tail) { lone_compile_emit(compiler, LONE_RETURN); return 0; }
+	lone_compile_emit(compiler, LONE_JUMP);
+	return lone_compile_emit(compiler, 0);
+}
 
-	if (lone_is_nil(arguments)) {
-		/* no variable to set: (set) */
-		linux_exit(-1);
-	}
+static void lone_compile_guarded(struct lone_compiler *compiler, struct lone_value *form, lone_primitive primitive, struct lone_value *arguments, int tail)
+{
+	size_t generic, alternative, end[2], depth = compiler->depth;
+
+	/* the operator is on the stack */
+	lone_compile_emit(compiler, LONE_GUARD);
+	lone_compile_emit(compiler, (unsigned long) primitive);
+	generic = lone_compile_emit(compiler, 0);
+	--compiler->depth;
+
+	if (primitive == lone_primitive_quote) {
+		lone_compile_emit(compiler, LONE_CONSTANT);
+		lone_compile_emit(compiler, (unsigned long) lone_list_first(arguments));
+		lone_compile_push(compiler);
+		end[1] = 0;
+	} else {
+		/* (if test consequent [alternative]) */
+		lone_compile_expression(compiler, lone_list_first(arguments), 0);
+		lone_compile_emit(compiler, LONE_JUMP_IF_NIL);
+		alternative = lone_compile_emit(compiler, 0);
+		--compiler->depth;
 
-	variable = lone_list_first(arguments);
-	if (variable->type != LONE_SYMBOL) {
-		/* variable names must be symbols: (set 10) */
-		linux_exit(-1);
-	}
+		arguments = lone_list_rest(arguments);
+		lone_compile_expression(compiler, lone_list_first(arguments), tail);
+		end[1] = lone_compile_exit(compiler, tail);
+		--compiler->depth;
 
-	arguments = lone_list_rest(arguments);
-	if (lone_is_nil(arguments)) {
-		/* value not specified: (set variable) */
-		value = lone_list_create_nil(lone);
-	} else {
-		/* (set variable value) */
-		value = lone_list_first(arguments);
+		lone_compile_patch(compiler, alternative);
 		arguments = lone_list_rest(arguments);
+		if (lone_is_nil(arguments)) {
+			lone_compile_emit(compiler, LONE_CONSTANT);
+			lone_compile_emit(compiler, (unsigned long) lone_list_create_nil(compiler->lone));
+			lone_compile_push(compiler);
+		} else {
+			lone_compile_expression(compiler, lone_list_first(arguments), tail);
+		}
 	}
 
-	if (!lone_is_nil(arguments)) { /* too many arguments */ linux_exit(-1); }
+	end[0] = lone_compile_exit(compiler, tail);
 
-	value = lone_evaluate(lone, environment, value);
-	lone_table_set(lone, environment, variable, value);
+	/* the operator is still on the stack if the guard failed */
+	lone_compile_patch(compiler, generic);
+	compiler->depth = depth;
+	lone_compile_emit(compiler, tail? LONE_TAIL_APPLY : LONE_EVALUATE);
+	lone_compile_emit(compiler, (unsigned long) form);
 
-	return value;
+	if (end[0]) { lone_compile_patch(compiler, end[0]); }
+	if (end[1]) { lone_compile_patch(compiler, end[1]); }
 }
 
-static struct lone_value *lone_primitive_quote(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+static void lone_compile_form(struct lone_compiler *compiler, struct lone_value *form, int tail)
 {
-	if (!lone_is_nil(lone_list_rest(arguments))) { /* too many arguments: (quote x y) */ linux_exit(-1); }
-	return lone_list_first(arguments);
-}
+	struct lone_value *operator = lone_list_first(form), *arguments = lone_list_rest(form);
+	size_t count = lone_list_count(arguments), end = 0, i;
+
+	lone_compile_expression(compiler, operator, 0);
+
+	if (lone_type_of(operator) == LONE_SYMBOL) {
+		if (count == 1 && lone_bytes_equals_c_string(operator->bytes, "quote")) {
+			lone_compile_guarded(compiler, form, lone_primitive_quote, arguments, tail);
+			return;
+		} else if ((count == 2 || count == 3) && lone_bytes_equals_c_string(operator->bytes, "if")) {
+			lone_compile_guarded(compiler, form, lone_primitive_if, arguments, tail);
+			return;
+		}
+	}
+
+	if (count == (size_t) -1) {
+		/* improper argument lists are left to the evaluator */
+		lone_compile_emit(compiler, tail? LONE_TAIL_APPLY : LONE_EVALUATE);
+		lone_compile_emit(compiler, (unsigned long) form);
+		return;
+	}
+
+	if (tail) {
+		lone_compile_emit(compiler, LONE_TAIL_PREPARE);
+		lone_compile_emit(compiler, (unsigned long) form);
+	} else {
+		lone_compile_emit(compiler, LONE_PREPARE);
+		lone_compile_emit(compiler, (unsigned long) form);
+		end = lone_compile_emit(compiler, 0);
+	}
+
+	for (i = 0; i < count; ++i, arguments = lone_list_rest(arguments)) {
+		lone_compile_expression(compiler, lone_list_first(arguments), 0);
+	}
+
+	lone_compile_emit(compiler, tail? LONE_TAIL_CALL : LONE_CALL);
+	lone_compile_emit(compiler, count);
+	compiler->depth -= count;
+
+	if (end) { lone_compile_patch(compiler, end); }
+}
+
+static void lone_compile_expression(struct lone_compiler *compiler, struct lone_value *value, int tail)
+{
+	if (value && !lone_is_nil(value)) {
+		switch (lone_type_of(value)) {
+		case LONE_LIST:
+			lone_compile_form(compiler, value, tail);
+			return;
+		case LONE_SYMBOL:
+			lone_compile_reference(compiler, value);
+			return;
+		case LONE_MODULE:
+		case LONE_FUNCTION:
+		case LONE_PRIMITIVE:
+		case LONE_VECTOR:
+		case LONE_TABLE:
+		case LONE_INTEGER:
+		case LONE_POINTER:
+		case LONE_READER:
+		case LONE_BYTES:
+		case LONE_TEXT:
+			/* these values evaluate to themselves */
+			break;
+		}
+	}
+
+	lone_compile_emit(compiler, LONE_CONSTANT);
+	lone_compile_emit(compiler, (unsigned long) value);
+	lone_compile_push(compiler);
+}
+
+static struct lone_bytecode *lone_compile(struct lone_lisp *lone, struct lone_value *function)
+{
+	struct lone_compiler compiler = { lone, function, 0, 0, 0, 0, 0 };
+	struct lone_value *code = function->function.code, *next;
+	struct lone_bytecode *bytecode;
+
+	/* bodies are evaluated in sequence, the value of the last one is returned */
+	while (1) {
+		next = lone_list_rest(code);
+
+		/* the results of functions which evaluate them are not in tail position */
+		lone_compile_expression(&compiler, lone_list_first(code), lone_is_nil(next) && !function->flags.evaluate_result);
+
+		code = next;
+		if (lone_is_nil(code)) { break; }
+		lone_compile_emit(&compiler, LONE_DISCARD);
+		--compiler.depth;
+	}
+
+	lone_compile_emit(&compiler, LONE_RETURN);
+
+	bytecode = lone_allocate(lone, sizeof(*bytecode) + compiler.count * sizeof(*bytecode->code));
+	bytecode->stack = compiler.maximum;
+	bytecode->count = compiler.count;
+	lone_memory_move(compiler.code, bytecode->code, compiler.count * sizeof(*bytecode->code));
+	lone_deallocate(lone, compiler.code);
+
+	return bytecode;
+}
+
+/* ╭─────────────────────┨ LONE LISP VIRTUAL MACHINE ┠──────────────────────╮
+   │                                                                        │
+   │    Executes compiled functions in their frames. The values pushed      │
+   │    by the code live in an array on the native stack where they are     │
+   │    found by the garbage collector like any other local variable.       │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static struct lone_value *lone_execute_skip(struct lone_lisp *lone, struct lone_value *frame, unsigned long depth, struct lone_value *symbol)
+{
+	struct lone_value *bindings;
+
+	/* returns the environment at depth or zero if a skipped frame shadows the symbol */
+	for (/* depth */; depth; --depth) {
+		bindings = lone_frame_bindings(frame);
+		if (bindings && lone_table_entry_find(lone, bindings->table.entries, bindings->table.capacity, symbol)) { return 0; }
+		frame = lone_frame_parent(frame);
+	}
+
+	return frame;
+}
+
+static struct lone_value *lone_execute_global(struct lone_lisp *lone, struct lone_value *frame, unsigned long *operands)
+{
+	struct lone_value *symbol = (struct lone_value *) operands[1], *table;
+	struct lone_table_entry *entry;
+
+	table = lone_execute_skip(lone, frame, operands[0], symbol);
+	if (!table) { return lone_environment_get(lone, frame, symbol); }
+
+	if (operands[2] != LONE_GLOBAL_UNCACHED && operands[3] == table->version) {
+		return table->table.entries[operands[2]].value;
+	}
+
+	entry = lone_table_entry_find(lone, table->table.entries, table->table.capacity, symbol);
+	if (!entry) { return lone_environment_get(lone, table, symbol); }
+
+	operands[2] = entry - table->table.entries;
+	operands[3] = table->version;
+	return entry->value;
+}
+
+static enum lone_result lone_execute_pending(int pending, struct lone_value *environment, struct lone_continuation *continuation)
+{
+	if (!pending) { return LONE_RESULT_VALUE; }
+	continuation->environment = environment;
+	return LONE_RESULT_EVALUATE;
+}
+
+static enum lone_result lone_execute(struct lone_lisp *lone, struct lone_value *frame, struct lone_bytecode *bytecode, struct lone_continuation *continuation)
+{
+	struct lone_value *stack[bytecode->stack + 1], **top = stack, *operator, *arguments, *environment, *value;
+	unsigned long *code = bytecode->code, *ip = code, count;
+	int pending;
+
+	while (1) {
+		switch ((enum lone_operation) *ip++) {
+		case LONE_CONSTANT:
+			*top++ = (struct lone_value *) *ip++;
+			break;
+		case LONE_LOCAL:
+			operator = lone_execute_skip(lone, frame, ip[0], (struct lone_value *) ip[2]);
+			*top++ = operator? *lone_frame_slot(operator, ip[1]) : lone_environment_get(lone, frame, (struct lone_value *) ip[2]);
+			ip += 3;
+			break;
+		case LONE_GLOBAL:
+			*top++ = lone_execute_global(lone, frame, ip);
+			ip += 4;
+			break;
+		case LONE_DISCARD:
+			--top;
+			break;
+		case LONE_JUMP:
+			ip = code + *ip;
+			break;
+		case LONE_JUMP_IF_NIL:
+			ip = lone_is_nil(*--top)? code + *ip : ip + 1;
+			break;
+		case LONE_GUARD:
+			operator = top[-1];
+			if (lone_type_of(operator) == LONE_PRIMITIVE && operator->primitive.function == (lone_primitive) ip[0]) {
+				--top;
+				ip += 2;
+			} else {
+				ip = code + ip[1];
+			}
+			break;
+		case LONE_PREPARE:
+			operator = top[-1];
+			switch (lone_type_of(operator)) {
+			case LONE_FUNCTION:
+			case LONE_PRIMITIVE:
+				if (operator->flags.evaluate_arguments) { ip += 2; break; }
+				/* fallthrough */
+			case LONE_MODULE:
+			case LONE_LIST:
+			case LONE_VECTOR:
+			case LONE_TABLE:
+			case LONE_SYMBOL:
+			case LONE_TEXT:
+			case LONE_BYTES:
+			case LONE_INTEGER:
+			case LONE_POINTER:
+			case LONE_READER:
+				top[-1] = lone_evaluate_application(lone, frame, operator, lone_list_rest((struct lone_value *) ip[0]));
+				ip = code + ip[1];
+				break;
+			}
+			break;
+		case LONE_CALL:
+			/* the arguments are passed in place, they stay on the stack until the call returns */
+			count = *ip++;
+			operator = top[-count - 1];
+			environment = frame;
+
+			if (lone_type_of(operator) == LONE_FUNCTION?
+			    lone_invoke(lone, &environment, operator, lone_frame_bind_values(lone, operator, top - count, count), &value) :
+			    lone_invoke_primitive_values(lone, &environment, operator, top - count, count, &value)) {
+				value = lone_evaluate(lone, environment, value);
+			}
+
+			top -= count;
+			top[-1] = value;
+			break;
+		case LONE_EVALUATE:
+			operator = top[-1];
+			top[-1] = lone_evaluate_application(lone, frame, operator, lone_list_rest((struct lone_value *) *ip++));
+			break;
+		case LONE_TAIL_PREPARE:
+			operator = top[-1];
+			if ((lone_type_of(operator) == LONE_FUNCTION || lone_type_of(operator) == LONE_PRIMITIVE) && operator->flags.evaluate_arguments) {
+				++ip;
+				break;
+			}
+			/* fallthrough */
+		case LONE_TAIL_APPLY:
+			operator = top[-1];
+			arguments = lone_list_rest((struct lone_value *) *ip);
+
+			switch (lone_type_of(operator)) {
+			case LONE_FUNCTION:
+				if (operator->flags.evaluate_arguments) { arguments = lone_evaluate_all(lone, frame, arguments); }
+				continuation->function = operator;
+				continuation->frame = lone_frame_bind(lone, operator, arguments);
+				return LONE_RESULT_CALL;
+			case LONE_PRIMITIVE:
+				environment = frame;
+				pending = lone_apply(lone, &environment, operator, arguments, &continuation->value);
+				return lone_execute_pending(pending, environment, continuation);
+			case LONE_MODULE:
+			case LONE_LIST:
+			case LONE_VECTOR:
+			case LONE_TABLE:
+			case LONE_SYMBOL:
+			case LONE_TEXT:
+			case LONE_BYTES:
+			case LONE_INTEGER:
+			case LONE_POINTER:
+			case LONE_READER:
+				continuation->value = lone_evaluate_application(lone, frame, operator, arguments);
+				return LONE_RESULT_VALUE;
+			}
+			break;
+		case LONE_TAIL_CALL:
+			count = *ip++;
+			operator = top[-count - 1];
+			environment = frame;
+
+			if (lone_type_of(operator) == LONE_FUNCTION) {
+				continuation->function = operator;
+				continuation->frame = lone_frame_bind_values(lone, operator, top - count, count);
+				return LONE_RESULT_CALL;
+			}
+
+			pending = lone_invoke_primitive_values(lone, &environment, operator, top - count, count, &continuation->value);
+			return lone_execute_pending(pending, environment, continuation);
+		case LONE_RETURN:
+			continuation->value = *--top;
+			return LONE_RESULT_VALUE;
+		}
+	}
+}
+
+/* ╭─────────────────────────┨ LONE LISP PRINTER ┠──────────────────────────╮
+   │                                                                        │
+   │    Transforms lone lisp objects into text in order to write it out.    │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Output is accumulated in a buffer and written out in one system     │
+   │    call when it fills up or output switches to another descriptor.     │
+   │    Payloads too large for the buffer are written out along with it     │
+   │    by a single writev call instead of being copied. The buffer is      │
+   │    also flushed after each top level expression is evaluated and       │
+   │    before system calls made by lisp code so output stays in order.     │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+/* returns zero if the output was lost */
+static int lone_output_write_all(int fd, struct iovec *vectors, int count)
+{
+	ssize_t written;
+
+	while (count > 0) {
+		written = linux_writev(fd, vectors, count);
+		if (written < 0) { /* output lost */ return 0; }
+
+		/* partial writes resume where they left off */
+		while (count > 0 && (size_t) written >= vectors->iov_len) {
+			written -= vectors->iov_len;
+			++vectors; --count;
+		}
+		if (count > 0) {
+			vectors->iov_base = (unsigned char *) vectors->iov_base + written;
+			vectors->iov_len -= written;
+		}
+	}
+
+	return 1;
+}
+
+static void lone_output_flush(struct lone_lisp *lone)
+{
+	struct iovec buffer = { lone->output.buffer, lone->output.count };
+
+	if (lone->output.count == 0) { return; }
+	lone_output_write_all(lone->output.file_descriptor, &buffer, 1);
+	lone->output.count = 0;
+}
+
+static void lone_output_write(struct lone_lisp *lone, int fd, const void *bytes, size_t count)
+{
+	if (fd != lone->output.file_descriptor) {
+		lone_output_flush(lone);
+		lone->output.file_descriptor = fd;
+	}
+
+	if (lone->output.count + count > LONE_OUTPUT_BUFFER_SIZE) {
+		if (count >= LONE_OUTPUT_BUFFER_SIZE / 2) {
+			struct iovec vectors[2] = {
+				{ lone->output.buffer, lone->output.count },
+				{ (void *) bytes, count },
+			};
+			lone_output_write_all(fd, vectors, 2);
+			lone->output.count = 0;
+			return;
+		}
+
+		lone_output_flush(lone);
+	}
+
+	lone_memory_move((void *) bytes, lone->output.buffer + lone->output.count, count);
+	lone->output.count += count;
+}
+
+static void lone_print(struct lone_lisp *, struct lone_value *, int);
+
+static void lone_print_integer(struct lone_lisp *lone, long n, int fd)
+{
+	static char digits[DECIMAL_DIGITS_PER_LONG + 1]; /* digits, sign */
+	char *digit = digits + DECIMAL_DIGITS_PER_LONG;  /* work backwards */
+	size_t count = 0;
+	int is_negative;
+
+	if (n < 0) {
+		is_negative = 1;
+		n *= -1;
+	} else {
+		is_negative = 0;
+	}
+
+	do {
+		*--digit = '0' + (n % 10);
+		n /= 10;
+		++count;
+	} while (n > 0);
+
+	if (is_negative) {
+		*--digit = '-';
+		++count;
+	}
+
+	lone_output_write(lone, fd, digit, count);
+}
+
+static void lone_print_bytes(struct lone_lisp *lone, struct lone_value *bytes, int fd)
+{
+	size_t count = bytes->bytes.count;
+	if (count == 0) { lone_output_write(lone, fd, "bytes[]", 7); return; }
+
+	static unsigned char hexadecimal[] = "0123456789ABCDEF";
+	unsigned char *byte = bytes->bytes.pointer;
+	size_t i;
+
+	lone_output_write(lone, fd, "bytes[0x", 8);
+
+	for (i = 0; i < count; ++i) {
+		unsigned char low  = (byte[i] & 0x0F) >> 0;
+		unsigned char high = (byte[i] & 0xF0) >> 4;
+
+		/* encoded directly into the output buffer */
+		if (lone->output.count + 2 > LONE_OUTPUT_BUFFER_SIZE) { lone_output_flush(lone); }
+		lone->output.buffer[lone->output.count++] = hexadecimal[high];
+		lone->output.buffer[lone->output.count++] = hexadecimal[low];
+	}
+
+	lone_output_write(lone, fd, "]", 1);
+}
+
+static void lone_print_list(struct lone_lisp *lone, struct lone_value *list, int fd)
+{
+	if (list == 0 || lone_is_nil(list)) { return; }
+
+	struct lone_value *first = list->list.first,
+	                  *rest  = list->list.rest;
+
+	lone_print(lone, first, fd);
+
+	if (lone_type_of(rest) == LONE_LIST) {
+		if (!lone_is_nil(rest)) {
+			lone_output_write(lone, fd, " ", 1);
+			lone_print_list(lone, rest, fd);
+		}
+	} else {
+		lone_output_write(lone, fd, " . ", 3);
+		lone_print(lone, rest, fd);
+	}
+}
+
+static void lone_print_vector(struct lone_lisp *lone, struct lone_value *vector, int fd)
+{
+	size_t n = vector->vector.count, i;
+	struct lone_value **values = vector->vector.values;
+
+	if (vector->vector.count == 0) { lone_output_write(lone, fd, "[]", 2); return; }
+
+	lone_output_write(lone, fd, "[ ", 2);
+
+	for (i = 0; i < n; ++i) {
+		lone_print(lone, values[i], fd);
+		lone_output_write(lone, fd, " ", 1);
+	}
+
+	lone_output_write(lone, fd, "]", 1);
+}
+
+static void lone_print_table(struct lone_lisp *lone, struct lone_value *table, int fd)
+{
+	size_t n = table->table.capacity, i;
+	struct lone_table_entry *entries = table->table.entries;
+
+	if (table->table.count == 0) { lone_output_write(lone, fd, "{}", 2); return; }
+
+	lone_output_write(lone, fd, "{ ", 2);
+
+	for (i = 0; i < n; ++i) {
+		struct lone_value *key   = entries[i].key,
+		                  *value = entries[i].value;
+
+
+		if (key) {
+			lone_print(lone, key, fd);
+			lone_output_write(lone, fd, " ", 1);
+			lone_print(lone, value, fd);
+			lone_output_write(lone, fd, " ", 1);
+		}
+	}
+
+	lone_output_write(lone, fd, "}", 1);
+}
+
+static void lone_print_function(struct lone_lisp *lone, struct lone_value *function, int fd)
+{
+	struct lone_value *arguments = function->function.arguments,
+	                  *code = function->function.code;
+
+	lone_output_write(lone, fd, "(𝛌 ", 6);
+	lone_print(lone, arguments, fd);
+
+	while (!lone_is_nil(code)) {
+		lone_output_write(lone, fd, "\n  ", 3);
+		lone_print(lone, lone_list_first(code), fd);
+		code = lone_list_rest(code);
+	}
+
+	lone_output_write(lone, fd, ")", 1);
+}
+
+static void lone_print_hash_notation(struct lone_lisp *lone, char *descriptor, struct lone_value *value, int fd)
+{
+	lone_output_write(lone, fd, "#<", 2);
+	lone_output_write(lone, fd, descriptor, lone_c_string_length(descriptor));
+	lone_output_write(lone, fd, " ", 1);
+	lone_print(lone, value, fd);
+	lone_output_write(lone, fd, ">", 1);
+}
+
+static void lone_print(struct lone_lisp *lone, struct lone_value *value, int fd)
+{
+	if (value == 0) { return; }
+	if (lone_is_nil(value)) { lone_output_write(lone, fd, "nil", 3); return; }
+
+	switch (lone_type_of(value)) {
+	case LONE_MODULE:
+		lone_print_hash_notation(lone, "module", value->module.name, fd);
+		break;
+	case LONE_PRIMITIVE:
+		lone_print_hash_notation(lone, "primitive", value->primitive.name, fd);
+		break;
+	case LONE_FUNCTION:
+		lone_print_function(lone, value, fd);
+		break;
+	case LONE_LIST:
+		lone_output_write(lone, fd, "(", 1);
+		lone_print_list(lone, value, fd);
+		lone_output_write(lone, fd, ")", 1);
+		break;
+	case LONE_VECTOR:
+		lone_print_vector(lone, value, fd);
+		break;
+	case LONE_TABLE:
+		lone_print_table(lone, value, fd);
+		break;
+	case LONE_BYTES:
+		lone_print_bytes(lone, value, fd);
+		break;
+	case LONE_SYMBOL:
+		lone_output_write(lone, fd, value->bytes.pointer, value->bytes.count);
+		break;
+	case LONE_TEXT:
+		lone_output_write(lone, fd, "\"", 1);
+		lone_output_write(lone, fd, value->bytes.pointer, value->bytes.count);
+		lone_output_write(lone, fd, "\"", 1);
+		break;
+	case LONE_INTEGER:
+		lone_print_integer(lone, lone_integer_of(value), fd);
+		break;
+	case LONE_POINTER:
+		lone_print_integer(lone, value->integer, fd);
+		break;
+	case LONE_READER:
+		lone_print_hash_notation(lone, "reader", lone_integer_create(lone, value->reader->file_descriptor), fd);
+		break;
+	}
+}
+
+/* ╭───────────────────┨ LONE LISP PRIMITIVE FUNCTIONS ┠────────────────────╮
+   │                                                                        │
+   │    Lone lisp functions implemented in C.                               │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static struct lone_value *lone_primitive_if(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+{
+	struct lone_value *value, *consequent, *alternative = 0;
+
+	/* these are the list cells holding the expressions so that references can be resolved */
+
+	if (lone_is_nil(arguments)) { /* test not specified: (if) */ lone_exit(lone, -1); }
+	value = arguments;
+	arguments = lone_list_rest(arguments);
+
+	if (lone_is_nil(arguments)) { /* consequent not specified: (if test) */ lone_exit(lone, -1); }
+	consequent = arguments;
+	arguments = lone_list_rest(arguments);
+
+	if (!lone_is_nil(arguments)) {
+		alternative = arguments;
+		arguments = lone_list_rest(arguments);
+		if (!lone_is_nil(arguments)) { /* too many values (if test consequent alternative extra) */ lone_exit(lone, -1); }
+	}
+
+	/* the chosen expression is evaluated in tail position */
+	if (!lone_is_nil(lone_evaluate_first(lone, environment, value))) {
+		return lone_list_first(consequent);
+	} else if (alternative) {
+		return lone_list_first(alternative);
+	}
+
+	return lone_list_create_nil(lone);
+}
+
+static struct lone_value *lone_primitive_let(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+{
+	struct lone_value *bindings, *first, *second, *rest, *value, *new_environment;
+
+	if (lone_is_nil(arguments)) { /* no variables to bind: (let) */ lone_exit(lone, -1); }
+	bindings = lone_list_first(arguments);
+	if (lone_type_of(bindings) != LONE_LIST) { /* expected list but got something else: (let 10) */ lone_exit(lone, -1); }
+
+	new_environment = lone_table_create(lone, 8, environment);
+
+	while (1) {
+		if (lone_is_nil(bindings)) { break; }
+		first = lone_list_first(bindings);
+		if (lone_type_of(first) != LONE_SYMBOL) { /* variable names must be symbols: (let ("x")) */ lone_exit(lone, -1); }
+		rest = lone_list_rest(bindings);
+		if (lone_is_nil(rest)) { /* incomplete variable/value list: (let (x 10 y)) */ lone_exit(lone, -1); }
+		second = lone_list_first(rest);
+		value = lone_evaluate(lone, new_environment, second);
+		lone_table_set(lone, new_environment, first, value);
+		bindings = lone_list_rest(rest);
+	}
+
+	value = lone_list_create_nil(lone);
+
+	while (!lone_is_nil(arguments = lone_list_rest(arguments))) {
+		value = lone_list_first(arguments);
+
+		/* the last expression is evaluated in tail position */
+		if (lone_is_nil(lone_list_rest(arguments))) { break; }
+		lone_evaluate(lone, new_environment, value);
+	}
+
+	lone->tail.environment = new_environment;
+	return value;
+}
+
+static struct lone_value *lone_primitive_set(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+{
+	struct lone_value *variable, *value;
+
+	if (lone_is_nil(arguments)) {
+		/* no variable to set: (set) */
+		lone_exit(lone, -1);
+	}
+
+	variable = lone_list_first(arguments);
+	if (lone_type_of(variable) != LONE_SYMBOL) {
+		/* variable names must be symbols: (set 10) */
+		lone_exit(lone, -1);
+	}
+
+	arguments = lone_list_rest(arguments);
+	if (lone_is_nil(arguments)) {
+		/* value not specified: (set variable) */
+		value = lone_list_create_nil(lone);
+	} else {
+		/* (set variable value) */
+		value = lone_list_first(arguments);
+		arguments = lone_list_rest(arguments);
+	}
+
+	if (!lone_is_nil(arguments)) { /* too many arguments */ lone_exit(lone, -1); }
+
+	value = lone_evaluate(lone, environment, value);
+	lone_environment_set(lone, environment, variable, value);
+
+	return value;
+}
+
+static struct lone_value *lone_primitive_quote(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+{
+	if (!lone_is_nil(lone_list_rest(arguments))) { /* too many arguments: (quote x y) */ lone_exit(lone, -1); }
+	return lone_list_first(arguments);
+}
+
+static struct lone_value *lone_primitive_lambda_with_flags(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments, struct lone_function_flags flags)
+{
+	struct lone_value *bindings, *code;
+
+	bindings = lone_list_first(arguments);
+	if (lone_type_of(bindings) != LONE_LIST) { /* parameters not a list: (lambda 10) */ lone_exit(lone, -1); }
+
+	code = lone_list_rest(arguments);
+	if (lone_is_nil(arguments)) { /* no code: (lambda (x)) */ lone_exit(lone, -1); }
+
+	return lone_function_create(lone, bindings, code, environment, flags);
+}
+
+static struct lone_value *lone_primitive_lambda(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+{
+	struct lone_function_flags flags = {
+		.evaluate_arguments = 1,
+		.evaluate_result = 0,
+		.variable_arguments = 0,
+	};
+
+	return lone_primitive_lambda_with_flags(lone, closure, environment, arguments, flags);
+}
+
+static struct lone_value *lone_primitive_lambda_bang(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+{
+	struct lone_function_flags flags = {
+		.evaluate_arguments = 0,
+		.evaluate_result = 0,
+		.variable_arguments = 0,
+	};
+
+	return lone_primitive_lambda_with_flags(lone, closure, environment, arguments, flags);
+}
+
+static struct lone_value *lone_primitive_lambda_star(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+{
+	struct lone_function_flags flags = {
+		.evaluate_arguments = 1,
+		.evaluate_result = 0,
+		.variable_arguments = 1,
+	};
+
+	return lone_primitive_lambda_with_flags(lone, closure, environment, arguments, flags);
+}
+
+static struct lone_value *lone_primitive_print(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	size_t i;
+
+	for (i = 0; i < count; ++i) {
+		lone_print(lone, arguments[i], 1);
+		lone_output_write(lone, 1, "\n", 1);
+	}
+
+	return lone_list_create_nil(lone);
+}
+
+static struct lone_value *lone_primitive_flush(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	if (count != 0) { /* too many arguments: (flush 1) */ lone_exit(lone, -1); }
+	lone_output_flush(lone);
+	return lone_list_create_nil(lone);
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Memory and collector statistics are gathered into a table when      │
+   │    they are requested. Values are counted by walking the slabs and     │
+   │    memory by walking the block list, so they cost nothing until then.  │
+   │    Pauses are measured in the same clock ticks as the profiler's.      │
+   │                                                                        │
+   │        (statistics)                                                    │
+   │        (collector-log 'true)      ; logs every collection to stderr    │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static char *lone_type_name(enum lone_type type)
+{
+	switch (type) {
+	case LONE_MODULE: return "module";
+	case LONE_FUNCTION: return "function";
+	case LONE_PRIMITIVE: return "primitive";
+	case LONE_LIST: return "list";
+	case LONE_VECTOR: return "vector";
+	case LONE_TABLE: return "table";
+	case LONE_SYMBOL: return "symbol";
+	case LONE_TEXT: return "text";
+	case LONE_BYTES: return "bytes";
+	case LONE_INTEGER: return "integer";
+	case LONE_POINTER: return "pointer";
+	case LONE_READER: return "reader";
+	}
+}
+
+static void lone_garbage_collector_log(struct lone_lisp *lone, int major)
+{
+	lone_output_write(lone, 2, major? "collection major live " : "collection minor live ", 22);
+	lone_print_integer(lone, lone->collector.old, 2);
+	lone_output_write(lone, 2, " freed ", 7);
+	lone_print_integer(lone, lone->collector.statistics.freed, 2);
+	lone_output_write(lone, 2, " ticks ", 7);
+	lone_print_integer(lone, lone->collector.statistics.ticks, 2);
+	lone_output_write(lone, 2, "\n", 1);
+	lone_output_flush(lone);
+}
+
+static void lone_statistics_set(struct lone_lisp *lone, struct lone_value *table, char *name, unsigned long number)
+{
+	lone_table_set(lone, table, lone_intern_c_string(lone, name), lone_integer_create(lone, number));
+}
+
+static struct lone_value *lone_primitive_statistics(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	unsigned long types[LONE_READER + 1] = { 0 }, slots = 0, live = 0, blocks = 0, free_blocks = 0,
+	              used = 0, free = 0, unused, largest = 0, regions = 0, mapped = 0;
+	struct lone_value *statistics, *values;
+	struct lone_value_slab *slab;
+	struct lone_memory_region *region;
+	struct lone_memory *block;
+	struct lone_memory_free *small;
+	unsigned long allocated;
+	size_t i, bit;
+
+	if (count != 0) { /* too many arguments: (statistics 1) */ lone_exit(lone, -1); }
+
+	for (slab = lone->values.slabs; slab; slab = slab->next) {
+		slots += LONE_VALUE_SLAB_SLOTS;
+		for (i = 0; i < LONE_VALUE_SLAB_BITMAP_WORDS; ++i) {
+			for (allocated = slab->allocated[i]; allocated; allocated &= allocated - 1) {
+				bit = __builtin_ctzl(allocated);
+				++types[slab->values[i * __BITS_PER_LONG + bit].type];
+				++live;
+			}
+		}
+	}
+
+	for (block = lone->memory.blocks; block; block = block->next) {
+		++blocks;
+		if (block->free) {
+			++free_blocks;
+			free += block->size;
+			if (block->size > largest) { largest = block->size; }
+		} else {
+			used += block->size;
+		}
+	}
+
+	/* the bump remainder and the small free lists live inside used blocks but are free */
+	unused = lone->memory.bump.end - lone->memory.bump.current;
+	for (i = 0; i < LONE_MEMORY_SIZE_CLASSES; ++i) {
+		for (small = lone->memory.free[i]; small; small = small->next) { unused += lone_memory_class_stride(i); }
+	}
+	used -= unused;
+	free += unused;
+
+	for (region = lone->memory.regions; region; region = region->next) {
+		++regions;
+		mapped += region->size;
+	}
+
+	/* counted before any of the statistics values are created */
+	statistics = lone_table_create(lone, 32, 0);
+	values = lone_table_create(lone, 16, 0);
+
+	for (i = 0; i <= LONE_READER; ++i) {
+		lone_statistics_set(lone, values, lone_type_name(i), types[i]);
+	}
+
+	lone_table_set(lone, statistics, lone_intern_c_string(lone, "values"), values);
+	lone_statistics_set(lone, statistics, "live-values", live);
+	lone_statistics_set(lone, statistics, "value-slots", slots);
+	lone_statistics_set(lone, statistics, "bytes-used", used);
+	lone_statistics_set(lone, statistics, "bytes-free", free);
+	lone_statistics_set(lone, statistics, "largest-free-block", largest);
+	lone_statistics_set(lone, statistics, "blocks", blocks);
+	lone_statistics_set(lone, statistics, "free-blocks", free_blocks);
+	lone_statistics_set(lone, statistics, "regions", regions);
+	lone_statistics_set(lone, statistics, "bytes-mapped", mapped);
+	lone_statistics_set(lone, statistics, "collections", lone->collector.statistics.collections);
+	lone_statistics_set(lone, statistics, "major-collections", lone->collector.statistics.major);
+	lone_statistics_set(lone, statistics, "last-freed", lone->collector.statistics.freed);
+	lone_statistics_set(lone, statistics, "last-pause", lone->collector.statistics.ticks);
+	lone_statistics_set(lone, statistics, "total-pause", lone->collector.statistics.total);
+
+	return statistics;
+}
+
+static struct lone_value *lone_primitive_collector_log(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	if (count != 1) { /* log setting required: (collector-log) */ lone_exit(lone, -1); }
+	lone->collector.log = !lone_is_nil(arguments[0]);
+	return lone_list_create_nil(lone);
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Profile reports are written to standard error. Each line is the     │
+   │    path of calls to a profile, separated by semicolons, followed by    │
+   │    the value of the metric. Functions have no names of their own so    │
+   │    they are named after the module variables they were bound to.       │
+   │                                                                        │
+   │        lone;f;g 3                                                      │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static enum lone_profile_metric lone_profile_metric_from(struct lone_bytes name)
+{
+	if (lone_bytes_equals_c_string(name, "calls")) { return LONE_PROFILE_CALLS; }
+	if (lone_bytes_equals_c_string(name, "allocations")) { return LONE_PROFILE_ALLOCATIONS; }
+	return LONE_PROFILE_TIME;
+}
+
+static unsigned long lone_profile_value(struct lone_lisp *lone, struct lone_profile *profile)
+{
+	switch (lone->profiler.metric) {
+	case LONE_PROFILE_TIME: return profile->ticks;
+	case LONE_PROFILE_CALLS: return profile->calls;
+	case LONE_PROFILE_ALLOCATIONS: return profile->bytes;
+	}
+}
+
+static void lone_profile_name_functions(struct lone_lisp *lone, struct lone_value *module)
+{
+	struct lone_table_entry *entries = module->module.environment->table.entries;
+	struct lone_profile *profile;
+	size_t i;
+
+	for (i = 0; i < module->module.environment->table.capacity; ++i) {
+		if (!entries[i].key || lone_type_of(entries[i].value) != LONE_FUNCTION) { continue; }
+
+		for (profile = lone->profiler.all; profile; profile = profile->next) {
+			if (profile->function == entries[i].value && !profile->name) { profile->name = entries[i].key; }
+		}
+	}
+}
+
+static void lone_profile_print_path(struct lone_lisp *lone, struct lone_profile *profile)
+{
+	struct lone_value *name;
+
+	if (profile->parent->function) {
+		lone_profile_print_path(lone, profile->parent);
+		lone_output_write(lone, 2, ";", 1);
+	}
+
+	name = lone_type_of(profile->function) == LONE_PRIMITIVE? profile->function->primitive.name : profile->name;
+
+	if (name) {
+		lone_output_write(lone, 2, name->bytes.pointer, name->bytes.count);
+	} else {
+		lone_output_write(lone, 2, "lambda", 6);
+	}
+}
+
+/* stable merge sort in descending order, equal profiles stay in the order they were created */
+static void lone_profile_sort(struct lone_lisp *lone, struct lone_profile **profiles, struct lone_profile **buffer, size_t count)
+{
+	struct lone_profile **from = profiles, **to = buffer, **swap;
+	size_t width, start, middle, end, left, right, i;
+
+	for (width = 1; width < count; width *= 2) {
+		for (start = 0; start < count; start += 2 * width) {
+			middle = start + width < count? start + width : count;
+			end = middle + width < count? middle + width : count;
+
+			for (left = start, right = middle, i = start; i < end; ++i) {
+				if (left < middle && (right >= end || lone_profile_value(lone, from[left]) >= lone_profile_value(lone, from[right]))) {
+					to[i] = from[left++];
+				} else {
+					to[i] = from[right++];
+				}
+			}
+		}
+
+		swap = from; from = to; to = swap;
+	}
+
+	if (from != profiles) { lone_memory_move(from, profiles, count * sizeof(*profiles)); }
+}
+
+static void lone_profile_report(struct lone_lisp *lone)
+{
+	struct lone_profile **profiles, **buffer, *profile;
+	struct lone_table_entry *modules;
+	size_t count, i;
+
+	if (!lone->profiler.root) { return; }
+	lone_profile_stop(lone);
+
+	lone_profile_name_functions(lone, lone->modules.null);
+	modules = lone->modules.loaded->table.entries;
+	for (i = 0; i < lone->modules.loaded->table.capacity; ++i) {
+		if (modules[i].key) { lone_profile_name_functions(lone, modules[i].value); }
+	}
+
+	profiles = lone_allocate(lone, lone->profiler.count * sizeof(*profiles));
+	buffer = lone_allocate(lone, lone->profiler.count * sizeof(*profiles));
+
+	/* the list of all profiles starts with the newest one */
+	count = lone->profiler.count;
+	for (profile = lone->profiler.all; profile; profile = profile->next) {
+		profiles[--count] = profile;
+	}
+
+	/* the root is the first profile, the time spent outside of any call */
+	for (i = 1, count = 0; i < lone->profiler.count; ++i) {
+		if (lone_profile_value(lone, profiles[i])) { profiles[count++] = profiles[i]; }
+	}
+
+	lone_profile_sort(lone, profiles, buffer, count);
+
+	for (i = 0; i < count; ++i) {
+		lone_profile_print_path(lone, profiles[i]);
+		lone_output_write(lone, 2, " ", 1);
+		lone_print_integer(lone, lone_profile_value(lone, profiles[i]), 2);
+		lone_output_write(lone, 2, "\n", 1);
+	}
+
+	lone_output_flush(lone);
+	lone_deallocate(lone, buffer);
+	lone_deallocate(lone, profiles);
+}
+
+/* (profile 'calls) starts profiling, (profile) stops it */
+static struct lone_value *lone_primitive_profile(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	if (count > 1) { /* too many arguments: (profile 'time 'calls) */ lone_exit(lone, -1); }
+
+	if (count == 0 || lone_is_nil(arguments[0])) {
+		lone_profile_stop(lone);
+		return lone_list_create_nil(lone);
+	}
+
+	switch (lone_type_of(arguments[0])) {
+	case LONE_SYMBOL:
+	case LONE_TEXT:
+		lone_profile_start(lone, lone_profile_metric_from(arguments[0]->bytes));
+		break;
+	case LONE_MODULE:
+	case LONE_FUNCTION:
+	case LONE_PRIMITIVE:
+	case LONE_LIST:
+	case LONE_VECTOR:
+	case LONE_TABLE:
+	case LONE_BYTES:
+	case LONE_INTEGER:
+	case LONE_POINTER:
+	case LONE_READER:
+		/* metric not a name: (profile 10) */ lone_exit(lone, -1);
+	}
+
+	return lone_list_create_nil(lone);
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Readers that are fed input instead of reading file descriptors.     │
+   │    Lisp code can feed them bytes as they arrive from any source        │
+   │    and keep as many of them at once as there are input streams.        │
+   │                                                                        │
+   │        (set r (reader))                                                │
+   │        (feed r "(print ")             ; buffers the input              │
+   │        (read r print)                 ; 0, the list is incomplete      │
+   │        (feed r "10)")                                                  │
+   │        (read r print)                 ; 1, printed (print 10)          │
+   │        (feed r)                       ; no more input will be fed      │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static struct lone_value *lone_primitive_reader(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	if (count != 0) { /* too many arguments: (reader 0) */ lone_exit(lone, -1); }
+	return lone_reader_create(lone, LONE_BUFFER_SIZE, -1);
+}
+
+static inline struct lone_reader *lone_reader_argument(struct lone_lisp *lone, struct lone_value *argument)
+{
+	if (lone_type_of(argument) != LONE_READER) { /* argument is not a reader */ lone_exit(lone, -1); }
+	return argument->reader;
+}
+
+static struct lone_value *lone_primitive_feed(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_reader *reader;
+	size_t i;
+
+	if (count == 0) { /* reader not specified: (feed) */ lone_exit(lone, -1); }
+	reader = lone_reader_argument(lone, arguments[0]);
+
+	if (reader->finished) { /* input was already finished: (feed r) (feed r "x") */ lone_exit(lone, -1); }
+
+	if (count == 1) {
+		/* end of input: values at its very end are complete */
+		reader->finished = 1;
+	}
 
-static struct lone_value *lone_primitive_lambda_with_flags(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments, struct lone_function_flags flags)
+	for (i = 1; i < count; ++i) {
+		switch (lone_type_of(arguments[i])) {
+		case LONE_BYTES:
+		case LONE_TEXT:
+		case LONE_SYMBOL:
+			lone_reader_feed(lone, reader, arguments[i]->bytes.pointer, arguments[i]->bytes.count);
+			break;
+		case LONE_MODULE:
+		case LONE_FUNCTION:
+		case LONE_PRIMITIVE:
+		case LONE_LIST:
+		case LONE_VECTOR:
+		case LONE_TABLE:
+		case LONE_INTEGER:
+		case LONE_POINTER:
+		case LONE_READER:
+			/* input must be made of bytes: (feed r 10) */ lone_exit(lone, -1);
+		}
+	}
+
+	return lone_list_create_nil(lone);
+}
+
+static struct lone_value *lone_primitive_read(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
 {
-	struct lone_value *bindings, *code;
+	struct lone_reader *reader;
+	struct lone_value *value;
+	long values = 0;
 
-	bindings = lone_list_first(arguments);
-	if (bindings->type != LONE_LIST) { /* parameters not a list: (lambda 10) */ linux_exit(-1); }
+	if (count != 2) { /* reader and function required: (read r) */ lone_exit(lone, -1); }
+	reader = lone_reader_argument(lone, arguments[0]);
 
-	code = lone_list_rest(arguments);
-	if (lone_is_nil(arguments)) { /* no code: (lambda (x)) */ linux_exit(-1); }
+	/* applies the function to every complete value, the rest is kept for later */
+	while ((value = lone_read(lone, reader))) {
+		lone_apply_values(lone, environment, arguments[1], &value, 1);
+		++values;
+	}
 
-	return lone_function_create(lone, bindings, code, environment, flags);
+	if (reader->error) { /* unmatched brackets: (feed r ")") */ lone_exit(lone, -1); }
+
+	return lone_integer_create(lone, values);
 }
 
-static struct lone_value *lone_primitive_lambda(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Built-in mathematical and numeric operations.                       │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static inline long lone_integer_argument(struct lone_lisp *lone, struct lone_value *argument)
 {
-	struct lone_function_flags flags = {
-		.evaluate_arguments = 1,
-		.evaluate_result = 0,
-		.variable_arguments = 0,
-	};
+	if (lone_type_of(argument) != LONE_INTEGER) { /* argument is not a number */ lone_exit(lone, -1); }
+	return lone_integer_of(argument);
+}
 
-	return lone_primitive_lambda_with_flags(lone, closure, environment, arguments, flags);
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    The operation is always a constant so these functions are always    │
+   │    inlined and reduced to the one operation each primitive needs.      │
+   │    Results which cannot be represented are errors, not wrapped.        │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static inline __attribute__((always_inline)) long lone_integer_operate(struct lone_lisp *lone, char operation, long x, long y)
+{
+	long result;
+	int overflow;
+
+	switch (operation) {
+	case '+': overflow = __builtin_add_overflow(x, y, &result); break;
+	case '-': overflow = __builtin_sub_overflow(x, y, &result); break;
+	case '*': overflow = __builtin_mul_overflow(x, y, &result); break;
+	case '/':
+	case '%':
+		if (y == 0) { /* division by zero: (/ 1 0) */ lone_exit(lone, -1); }
+		overflow = x == -__LONG_MAX__ - 1 && y == -1;
+		if (!overflow) { result = operation == '/'? x / y : x % y; }
+		break;
+	case '&': overflow = 0; result = x & y; break;
+	case '|': overflow = 0; result = x | y; break;
+	case '^': overflow = 0; result = x ^ y; break;
+	case 'l':
+	case 'r':
+		if (y < 0 || y >= (long) (sizeof(long) * 8)) { /* invalid shift amount: (<< 1 -1), (<< 1 64) */ lone_exit(lone, -1); }
+		if (operation == 'r') { overflow = 0; result = x >> y; break; }
+		result = (long) ((unsigned long) x << y);
+		overflow = (result >> y) != x;
+		break;
+	default: /* invalid primitive integer operation */ lone_exit(lone, -1);
+	}
+
+	if (overflow) { /* result does not fit in an integer */ lone_exit(lone, -1); }
+
+	return result;
 }
 
-static struct lone_value *lone_primitive_lambda_bang(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+static inline __attribute__((always_inline)) int lone_integer_compare(struct lone_lisp *lone, char comparison, long x, long y)
 {
-	struct lone_function_flags flags = {
-		.evaluate_arguments = 0,
-		.evaluate_result = 0,
-		.variable_arguments = 0,
-	};
+	switch (comparison) {
+	case '<': return x < y;
+	case 'l': return x <= y;
+	case '>': return x > y;
+	case 'g': return x >= y;
+	case '=': return x == y;
+	default: /* invalid primitive integer comparison */ lone_exit(lone, -1);
+	}
+}
 
-	return lone_primitive_lambda_with_flags(lone, closure, environment, arguments, flags);
+static inline __attribute__((always_inline)) struct lone_value *lone_primitive_integer_operation(struct lone_lisp *lone, size_t count, struct lone_value **arguments, char operation, long accumulator)
+{
+	size_t i;
+
+	/* two operands are the common case */
+	if (count == 2) {
+		accumulator = lone_integer_operate(lone, operation, accumulator, lone_integer_argument(lone, arguments[0]));
+		accumulator = lone_integer_operate(lone, operation, accumulator, lone_integer_argument(lone, arguments[1]));
+		return lone_integer_create(lone, accumulator);
+	}
+
+	/* not given any arguments to operate on returns the accumulator: (+), (-), (*) */
+	for (i = 0; i < count; ++i) {
+		accumulator = lone_integer_operate(lone, operation, accumulator, lone_integer_argument(lone, arguments[i]));
+	}
+
+	return lone_integer_create(lone, accumulator);
 }
 
-static struct lone_value *lone_primitive_lambda_star(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+static inline __attribute__((always_inline)) struct lone_value *lone_primitive_integer_binary_operation(struct lone_lisp *lone, size_t count, struct lone_value **arguments, char operation)
 {
-	struct lone_function_flags flags = {
-		.evaluate_arguments = 1,
-		.evaluate_result = 0,
-		.variable_arguments = 1,
-	};
+	if (count != 2) { /* exactly two operands are required: (% 10), (<< 1 2 3) */ lone_exit(lone, -1); }
+	return lone_integer_create(lone, lone_integer_operate(lone, operation, lone_integer_argument(lone, arguments[0]), lone_integer_argument(lone, arguments[1])));
+}
 
-	return lone_primitive_lambda_with_flags(lone, closure, environment, arguments, flags);
+static inline __attribute__((always_inline)) struct lone_value *lone_primitive_integer_comparison(struct lone_lisp *lone, struct lone_value *truth, size_t count, struct lone_value **arguments, char comparison)
+{
+	size_t i;
+
+	if (count == 0) { /* nothing to compare: (<) */ lone_exit(lone, -1); }
+
+	/* two operands are the common case */
+	if (count == 2) {
+		return lone_integer_compare(lone, comparison, lone_integer_argument(lone, arguments[0]), lone_integer_argument(lone, arguments[1]))?
+		       truth : lone_list_create_nil(lone);
+	}
+
+	/* (< a b c) is true when every argument is less than the next */
+	lone_integer_argument(lone, arguments[0]);
+	for (i = 1; i < count; ++i) {
+		if (!lone_integer_compare(lone, comparison, lone_integer_argument(lone, arguments[i - 1]), lone_integer_argument(lone, arguments[i]))) {
+			return lone_list_create_nil(lone);
+		}
+	}
+
+	return truth;
 }
 
-static struct lone_value *lone_primitive_print(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+static struct lone_value *lone_primitive_add(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
 {
-	while (!lone_is_nil(arguments)) {
-		lone_print(lone, lone_list_first(arguments), 1);
-		linux_write(1, "\n", 1);
-		arguments = lone_list_rest(arguments);
+	return lone_primitive_integer_operation(lone, count, arguments, '+', 0);
+}
+
+static struct lone_value *lone_primitive_subtract(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_operation(lone, count, arguments, '-', 0);
+}
+
+static struct lone_value *lone_primitive_multiply(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_operation(lone, count, arguments, '*', 1);
+}
+
+static struct lone_value *lone_primitive_divide(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	long dividend, divisor;
+
+	if (count == 0) { /* at least the dividend is required, (/) is invalid */ lone_exit(lone, -1); }
+	dividend = lone_integer_argument(lone, arguments[0]);
+
+	if (count == 1) {
+		/* not given a divisor, return 1/x instead: (/ 2) = 1/2 */
+		return lone_integer_create(lone, lone_integer_operate(lone, '/', 1, dividend));
+	} else {
+		/* (/ x a b c ...) = x / (a * b * c * ...) */
+		divisor = lone_integer_argument(lone, arguments[1]);
+		for (size_t i = 2; i < count; ++i) { divisor = lone_integer_operate(lone, '*', divisor, lone_integer_argument(lone, arguments[i])); }
+		return lone_integer_create(lone, lone_integer_operate(lone, '/', dividend, divisor));
 	}
+}
 
-	return lone_list_create_nil(lone);
+static struct lone_value *lone_primitive_remainder(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_binary_operation(lone, count, arguments, '%');
+}
+
+static struct lone_value *lone_primitive_bitwise_and(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_operation(lone, count, arguments, '&', -1);
+}
+
+static struct lone_value *lone_primitive_bitwise_or(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_operation(lone, count, arguments, '|', 0);
+}
+
+static struct lone_value *lone_primitive_bitwise_xor(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_operation(lone, count, arguments, '^', 0);
+}
+
+static struct lone_value *lone_primitive_shift_left(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_binary_operation(lone, count, arguments, 'l');
+}
+
+static struct lone_value *lone_primitive_shift_right(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_binary_operation(lone, count, arguments, 'r');
+}
+
+/* the closure of comparison primitives is the symbol they return when true */
+static struct lone_value *lone_primitive_less_than(struct lone_lisp *lone, struct lone_value *truth, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_comparison(lone, truth, count, arguments, '<');
+}
+
+static struct lone_value *lone_primitive_less_than_or_equal(struct lone_lisp *lone, struct lone_value *truth, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_comparison(lone, truth, count, arguments, 'l');
+}
+
+static struct lone_value *lone_primitive_greater_than(struct lone_lisp *lone, struct lone_value *truth, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_comparison(lone, truth, count, arguments, '>');
+}
+
+static struct lone_value *lone_primitive_greater_than_or_equal(struct lone_lisp *lone, struct lone_value *truth, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_comparison(lone, truth, count, arguments, 'g');
+}
+
+static struct lone_value *lone_primitive_equal(struct lone_lisp *lone, struct lone_value *truth, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_primitive_integer_comparison(lone, truth, count, arguments, '=');
 }
 
 /* ╭────────────────────────────────────────────────────────────────────────╮
    │                                                                        │
-   │    Built-in mathematical and numeric operations.                       │
+   │    Built-in operations on bytes. Unlike texts and symbols, bytes can   │
+   │    be changed in place so that buffers can be reused by system calls.  │
+   │    Slices share the memory of the bytes they were made from, without   │
+   │    copying it. Integers are loaded and stored in native byte order,    │
+   │    at any offset, so that kernel structures can be read where they     │
+   │    are. Offsets and counts are checked against the size of the bytes.  │
+   │                                                                        │
+   │        (set buffer (allocate 64))                                      │
+   │        (system-call 'read 0 buffer 64)                                 │
+   │        (load (slice buffer 8) 0 4)                                     │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+typedef unsigned short __attribute__((may_alias, aligned(1))) lone_unaligned_16;
+typedef unsigned int __attribute__((may_alias, aligned(1))) lone_unaligned_32;
+typedef unsigned long long __attribute__((may_alias, aligned(1))) lone_unaligned_64;
+
+static struct lone_value *lone_bytes_argument(struct lone_lisp *lone, struct lone_value *value)
+{
+	if (lone_type_of(value) != LONE_BYTES) { /* not bytes: (fill "text" 0) */ lone_exit(lone, -1); }
+	return value;
+}
+
+static struct lone_bytes lone_bytes_like_argument(struct lone_lisp *lone, struct lone_value *value)
+{
+	switch (lone_type_of(value)) {
+	case LONE_BYTES:
+	case LONE_TEXT:
+	case LONE_SYMBOL:
+		return value->bytes;
+	case LONE_MODULE:
+	case LONE_FUNCTION:
+	case LONE_PRIMITIVE:
+	case LONE_LIST:
+	case LONE_VECTOR:
+	case LONE_TABLE:
+	case LONE_POINTER:
+	case LONE_READER:
+	case LONE_INTEGER:
+		/* no bytes: (copy buffer 0 10) */ lone_exit(lone, -1);
+	}
+}
+
+/* offset and count must both be within the bytes */
+static void lone_bytes_check_range(struct lone_lisp *lone, struct lone_bytes bytes, long offset, long count)
+{
+	if (offset < 0 || count < 0 || (size_t) offset > bytes.count || (size_t) count > bytes.count - offset) {
+		/* out of bounds: (load (allocate 4) 2 4) */ lone_exit(lone, -1);
+	}
+}
+
+static struct lone_value *lone_primitive_bytes_allocate(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *value;
+	unsigned char *memory;
+	long size;
+
+	if (count != 1) { /* size required: (allocate) */ lone_exit(lone, -1); }
+	size = lone_integer_argument(lone, arguments[0]);
+	if (size < 0) { /* negative size: (allocate -1) */ lone_exit(lone, -1); }
+
+	memory = lone_allocate(lone, size);
+	lone_memory_zero(memory, size);
+	value = lone_bytes_create_borrowed(lone, memory, size);
+	value->borrowed = 0;
+
+	return value;
+}
+
+static struct lone_value *lone_primitive_bytes_count(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	if (count != 1) { /* bytes required: (count) */ lone_exit(lone, -1); }
+	return lone_integer_create(lone, lone_bytes_like_argument(lone, arguments[0]).count);
+}
+
+static struct lone_value *lone_primitive_bytes_slice(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *bytes, *slice;
+	long offset, length;
+
+	if (count < 2 || count > 3) { /* bytes, offset and optional count required: (slice buffer) */ lone_exit(lone, -1); }
+	bytes = lone_bytes_argument(lone, arguments[0]);
+	offset = lone_integer_argument(lone, arguments[1]);
+	length = count == 3? lone_integer_argument(lone, arguments[2]) : (long) bytes->bytes.count - offset;
+	lone_bytes_check_range(lone, bytes->bytes, offset, length);
+
+	slice = lone_bytes_create_borrowed(lone, bytes->bytes.pointer + offset, length);
+	/* slices of slices share the memory of the original bytes */
+	slice->owner = bytes->owner? bytes->owner : bytes;
+
+	return slice;
+}
+
+static inline __attribute__((always_inline)) struct lone_value *lone_bytes_load(struct lone_lisp *lone, size_t count, struct lone_value **arguments, int is_signed)
+{
+	struct lone_bytes bytes;
+	unsigned char *address;
+	long offset, width, integer;
+
+	if (count != 3) { /* bytes, offset and width required: (load buffer 0) */ lone_exit(lone, -1); }
+	bytes = lone_bytes_like_argument(lone, arguments[0]);
+	offset = lone_integer_argument(lone, arguments[1]);
+	width = lone_integer_argument(lone, arguments[2]);
+	lone_bytes_check_range(lone, bytes, offset, width);
+	address = bytes.pointer + offset;
+
+	switch (width) {
+	case 1: integer = is_signed? (long) (signed char) *address : (long) *address; break;
+	case 2: integer = is_signed? (long) (short) *(lone_unaligned_16 *) address : (long) *(lone_unaligned_16 *) address; break;
+	case 4: integer = is_signed? (long) (int) *(lone_unaligned_32 *) address : (long) *(lone_unaligned_32 *) address; break;
+	case 8: integer = (long) *(lone_unaligned_64 *) address; break;
+	default: /* integers are 1, 2, 4 or 8 bytes wide: (load buffer 0 3) */ lone_exit(lone, -1);
+	}
+
+	return lone_integer_create(lone, integer);
+}
+
+static struct lone_value *lone_primitive_bytes_load(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_bytes_load(lone, count, arguments, 0);
+}
+
+static struct lone_value *lone_primitive_bytes_load_signed(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_bytes_load(lone, count, arguments, 1);
+}
+
+/* integers are truncated to the width they are stored with */
+static struct lone_value *lone_primitive_bytes_store(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *bytes;
+	unsigned char *address;
+	long offset, width, integer;
+
+	if (count != 4) { /* bytes, offset, width and integer required: (store buffer 0 4) */ lone_exit(lone, -1); }
+	bytes = lone_bytes_argument(lone, arguments[0]);
+	offset = lone_integer_argument(lone, arguments[1]);
+	width = lone_integer_argument(lone, arguments[2]);
+	integer = lone_integer_argument(lone, arguments[3]);
+	lone_bytes_check_range(lone, bytes->bytes, offset, width);
+	address = bytes->bytes.pointer + offset;
+
+	switch (width) {
+	case 1: *address = integer; break;
+	case 2: *(lone_unaligned_16 *) address = integer; break;
+	case 4: *(lone_unaligned_32 *) address = integer; break;
+	case 8: *(lone_unaligned_64 *) address = integer; break;
+	default: /* integers are 1, 2, 4 or 8 bytes wide: (store buffer 0 3 0) */ lone_exit(lone, -1);
+	}
+
+	return bytes;
+}
+
+static struct lone_value *lone_primitive_bytes_fill(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *bytes;
+
+	if (count != 2) { /* bytes and byte required: (fill buffer) */ lone_exit(lone, -1); }
+	bytes = lone_bytes_argument(lone, arguments[0]);
+	lone_memory_fill(bytes->bytes.pointer, lone_integer_argument(lone, arguments[1]), bytes->bytes.count);
+
+	return bytes;
+}
+
+/* the source may overlap the destination, slices of the same bytes may be copied */
+static struct lone_value *lone_primitive_bytes_copy(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *bytes;
+	struct lone_bytes source;
+	long offset;
+
+	if (count != 3) { /* destination, offset and source required: (copy buffer 0) */ lone_exit(lone, -1); }
+	bytes = lone_bytes_argument(lone, arguments[0]);
+	offset = lone_integer_argument(lone, arguments[1]);
+	source = lone_bytes_like_argument(lone, arguments[2]);
+	lone_bytes_check_range(lone, bytes->bytes, offset, source.count);
+
+	lone_memory_move(source.pointer, bytes->bytes.pointer + offset, source.count);
+
+	return bytes;
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Built-in operations on vectors. They loop over the elements in C    │
+   │    instead of indexing the vector once per element in lisp code.       │
+   │    Elements that were never set are nil.                               │
+   │                                                                        │
+   │        (set squares (map (from-list '(1 2 3)) (lambda (x) (* x x))))   │
+   │        (reduce squares + 0)                                            │
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
-static struct lone_value *lone_primitive_integer_operation(struct lone_lisp *lone, struct lone_value *arguments, char operation)
+static struct lone_value *lone_vector_argument(struct lone_lisp *lone, struct lone_value *value)
 {
-	struct lone_value *argument;
-	long accumulator;
+	if (lone_type_of(value) != LONE_VECTOR) { /* not a vector: (push () 1) */ lone_exit(lone, -1); }
+	return value;
+}
 
-	switch (operation) {
-	case '+': case '-': accumulator = 0; break;
-	case '*': accumulator = 1; break;
-	default: /* invalid primitive integer operation */ linux_exit(-1);
+static inline struct lone_value *lone_vector_element(struct lone_lisp *lone, struct lone_value *vector, size_t i)
+{
+	struct lone_value *value = vector->vector.values[i];
+	return value? value : lone_list_create_nil(lone);
+}
+
+static struct lone_value *lone_primitive_vector_count(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	if (count != 1) { /* vector required: (count) */ lone_exit(lone, -1); }
+	return lone_integer_create(lone, lone_vector_argument(lone, arguments[0])->vector.count);
+}
+
+static struct lone_value *lone_primitive_vector_from_list(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *vector, *list;
+
+	if (count != 1) { /* list required: (from-list) */ lone_exit(lone, -1); }
+	list = arguments[0];
+	if (lone_type_of(list) != LONE_LIST) { /* not a list: (from-list []) */ lone_exit(lone, -1); }
+
+	vector = lone_vector_create(lone, lone_list_count(list));
+	for (/* list */; !lone_is_nil(list); list = lone_list_rest(list)) {
+		lone_vector_push(lone, vector, lone_list_first(list));
+	}
+
+	return vector;
+}
+
+static struct lone_value *lone_primitive_vector_push(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *vector;
+	size_t i;
+
+	if (count < 1) { /* vector required: (push) */ lone_exit(lone, -1); }
+	vector = lone_vector_argument(lone, arguments[0]);
+
+	lone_vector_grow(lone, vector, vector->vector.count + count - 1);
+	for (i = 1; i < count; ++i) { lone_vector_push(lone, vector, arguments[i]); }
+
+	return vector;
+}
+
+static struct lone_value *lone_primitive_vector_pop(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *vector, *value;
+
+	if (count != 1) { /* vector required: (pop) */ lone_exit(lone, -1); }
+	vector = lone_vector_argument(lone, arguments[0]);
+	if (!vector->vector.count) { /* vector is empty: (pop []) */ lone_exit(lone, -1); }
+
+	value = lone_vector_element(lone, vector, --vector->vector.count);
+	vector->vector.values[vector->vector.count] = 0;
+
+	return value;
+}
+
+/* the vector grows or shrinks to the count if one is given */
+static struct lone_value *lone_primitive_vector_fill(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *vector, *value;
+	long elements;
+	size_t i;
+
+	if (count < 2 || count > 3) { /* vector, value and optional count required: (fill []) */ lone_exit(lone, -1); }
+	vector = lone_vector_argument(lone, arguments[0]);
+	value = arguments[1];
+
+	if (count == 3) {
+		elements = lone_integer_argument(lone, arguments[2]);
+		if (elements < 0) { /* negative count: (fill [] 0 -1) */ lone_exit(lone, -1); }
+		lone_vector_grow(lone, vector, elements);
+		for (i = elements; i < vector->vector.count; ++i) { vector->vector.values[i] = 0; }
+		vector->vector.count = elements;
+	}
+
+	lone_write_barrier(vector);
+	for (i = 0; i < vector->vector.count; ++i) { vector->vector.values[i] = value; }
+
+	return vector;
+}
+
+/* slices are new vectors with the elements from start up to but excluding end */
+static struct lone_value *lone_primitive_vector_slice(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *vector, *slice;
+	long start, end;
+
+	if (count < 2 || count > 3) { /* vector, start and optional end required: (slice []) */ lone_exit(lone, -1); }
+	vector = lone_vector_argument(lone, arguments[0]);
+	start = lone_integer_argument(lone, arguments[1]);
+	end = count == 3? lone_integer_argument(lone, arguments[2]) : (long) vector->vector.count;
+	if (start < 0 || end < start || (size_t) end > vector->vector.count) { /* out of bounds: (slice [] 0 1) */ lone_exit(lone, -1); }
+
+	slice = lone_vector_create(lone, end - start);
+	lone_memory_move(vector->vector.values + start, slice->vector.values, (end - start) * sizeof(*slice->vector.values));
+	slice->vector.count = end - start;
+
+	return slice;
+}
+
+/* the function may change the vector, its count is checked for every element */
+static struct lone_value *lone_primitive_vector_map(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *vector, *function, *value;
+	size_t i;
+
+	if (count != 2) { /* vector and function required: (map []) */ lone_exit(lone, -1); }
+	vector = lone_vector_argument(lone, arguments[0]);
+	function = arguments[1];
+
+	for (i = 0; i < vector->vector.count; ++i) {
+		value = lone_vector_element(lone, vector, i);
+		value = lone_apply_values(lone, environment, function, &value, 1);
+		if (i < vector->vector.count) {
+			lone_write_barrier(vector);
+			vector->vector.values[i] = value;
+		}
 	}
 
-	if (lone_is_nil(arguments)) { /* wasn't given any arguments to operate on: (+), (-), (*) */ goto return_accumulator; }
+	return vector;
+}
 
-	do {
-		argument = lone_list_first(arguments);
-		if (argument->type != LONE_INTEGER) { /* argument is not a number */ linux_exit(-1); }
+static struct lone_value *lone_primitive_vector_reduce(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *vector, *function, *values[2];
+	size_t i;
 
-		switch (operation) {
-		case '+': accumulator += argument->integer; break;
-		case '-': accumulator -= argument->integer; break;
-		case '*': accumulator *= argument->integer; break;
-		default: /* invalid primitive integer operation */ linux_exit(-1);
-		}
+	if (count != 3) { /* vector, function and initial value required: (reduce [] +) */ lone_exit(lone, -1); }
+	vector = lone_vector_argument(lone, arguments[0]);
+	function = arguments[1];
+	values[0] = arguments[2];
 
-		arguments = lone_list_rest(arguments);
-	} while (!lone_is_nil(arguments));
+	for (i = 0; i < vector->vector.count; ++i) {
+		values[1] = lone_vector_element(lone, vector, i);
+		values[0] = lone_apply_values(lone, environment, function, values, 2);
+	}
 
-return_accumulator:
-	return lone_integer_create(lone, accumulator);
+	return values[0];
 }
 
-static struct lone_value *lone_primitive_add(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Module importing and loading operations.                            │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Module members which are expensive to create can be deferred        │
+   │    until they are first imported. They are created by primitives       │
+   │    which are applied without any arguments when they are needed.       │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static void lone_module_defer(struct lone_lisp *lone, struct lone_value *module, struct lone_value *name, struct lone_value *primitive)
 {
-	return lone_primitive_integer_operation(lone, arguments, '+');
+	if (!module->module.deferred) {
+		module->module.deferred = lone_table_create(lone, 8, 0);
+		lone_write_barrier(module);
+	}
+	lone_table_set(lone, module->module.deferred, name, primitive);
 }
 
-static struct lone_value *lone_primitive_subtract(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+static struct lone_value *lone_module_get(struct lone_lisp *lone, struct lone_value *module, struct lone_value *name)
 {
-	return lone_primitive_integer_operation(lone, arguments, '-');
-}
+	struct lone_value *value = lone_table_get(lone, module->module.environment, name), *primitive;
 
-static struct lone_value *lone_primitive_multiply(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
-{
-	return lone_primitive_integer_operation(lone, arguments, '*');
+	if (lone_is_nil(value) && module->module.deferred) {
+		primitive = lone_table_get(lone, module->module.deferred, name);
+
+		if (!lone_is_nil(primitive)) {
+			value = lone_apply_values(lone, module->module.environment, primitive, 0, 0);
+			lone_table_set(lone, module->module.environment, name, value);
+		}
+	}
+
+	return value;
 }
 
-static struct lone_value *lone_primitive_divide(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
+static void lone_module_create_deferred(struct lone_lisp *lone, struct lone_value *module)
 {
-	struct lone_value *dividend, *divisor;
+	struct lone_table_entry *entries;
+	size_t i;
 
-	if (lone_is_nil(arguments)) { /* at least the dividend is required, (/) is invalid */ linux_exit(-1); }
-	dividend = lone_list_first(arguments);
-	if (dividend->type != LONE_INTEGER) { /* can't divide non-numbers: (/ "not a number) */ linux_exit(-1); }
-	arguments = lone_list_rest(arguments);
+	if (!module->module.deferred) { return; }
 
-	if (lone_is_nil(arguments)) {
-		/* not given a divisor, return 1/x instead: (/ 2) = 1/2 */
-		return lone_integer_create(lone, 1 / dividend->integer);
-	} else {
-		/* (/ x a b c ...) = x / (a * b * c * ...) */
-		divisor = lone_primitive_integer_operation(lone, arguments, '*');
-		return lone_integer_create(lone, dividend->integer / divisor->integer);
+	entries = module->module.deferred->table.entries;
+	for (i = 0; i < module->module.deferred->table.capacity; ++i) {
+		if (entries[i].key) { lone_module_get(lone, module, entries[i].key); }
 	}
 }
 
-/* ╭────────────────────────────────────────────────────────────────────────╮
-   │                                                                        │
-   │    Module importing and loading operations.                            │
-   │                                                                        │
-   ╰────────────────────────────────────────────────────────────────────────╯ */
 static struct lone_value *lone_primitive_import(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, struct lone_value *arguments)
 {
 	struct lone_value *argument, *name, *module, *value;
 
-	if (lone_is_nil(arguments)) { /* nothing to import: (import) */ linux_exit(-1); }
+	if (lone_is_nil(arguments)) { /* nothing to import: (import) */ lone_exit(lone, -1); }
 
 	for (/* argument */; !lone_is_nil(arguments); arguments = lone_list_rest(arguments)) {
 		argument = lone_list_first(arguments);
-		if (argument->type != LONE_LIST) { /* not an import list: (import module) */ linux_exit(-1); }
+		if (lone_type_of(argument) != LONE_LIST) { /* not an import list: (import module) */ lone_exit(lone, -1); }
 
-		if (lone_is_nil(argument)) { /* nothing to import: (import ()) */ linux_exit(-1); }
+		if (lone_is_nil(argument)) { /* nothing to import: (import ()) */ lone_exit(lone, -1); }
 		name = lone_list_first(argument);
-		if (name->type != LONE_SYMBOL) { /* module name not a symbol: (import (10)) */ linux_exit(-1); }
+		if (lone_type_of(name) != LONE_SYMBOL) { /* module name not a symbol: (import (10)) */ lone_exit(lone, -1); }
 		module = lone_table_get(lone, lone->modules.loaded, name);
-		if (lone_is_nil(module)) { /* module not found: (import (non-existent)) */ linux_exit(-1); }
+		if (lone_is_nil(module)) { /* module not found: (import (non-existent)) */ lone_exit(lone, -1); }
 		argument = lone_list_rest(argument);
 
 		if (lone_is_nil(argument)) {
 			/* full import, bind all symbols: (import (module)) */
+			lone_module_create_deferred(lone, module);
 			struct lone_table_entry *entries = module->module.environment->table.entries;
 			size_t i, capacity = module->module.environment->table.capacity;
 			for (i = 0; i < capacity; ++i) {
 				if (entries[i].key) {
-					lone_table_set(lone, environment, entries[i].key, entries[i].value);
+					lone_environment_set(lone, environment, entries[i].key, entries[i].value);
 				}
 			}
 		} else {
 			/* limited import, bind only specified symbols: (import (module x f)) */
 			do {
 				name = lone_list_first(argument);
-				if (name->type != LONE_SYMBOL) { /* name not a symbol: (import (module 10)) */ linux_exit(-1); }
+				if (lone_type_of(name) != LONE_SYMBOL) { /* name not a symbol: (import (module 10)) */ lone_exit(lone, -1); }
 
-				value = lone_table_get(lone, module->module.environment, name);
-				if (lone_is_nil(value)) { /* name not set in module */ linux_exit(-1); }
+				value = lone_module_get(lone, module, name);
+				if (lone_is_nil(value)) { /* name not set in module */ lone_exit(lone, -1); }
 
-				lone_table_set(lone, environment, name, value);
+				lone_environment_set(lone, environment, name, value);
 
 				argument = lone_list_rest(argument);
 			} while (!lone_is_nil(argument));
@@ -1929,15 +5165,62 @@ static struct lone_value *lone_primitive_import(struct lone_lisp *lone, struct l
    │    Linux primitive functions for issuing system calls.                 │
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
-static inline long lone_value_to_linux_system_call_number(struct lone_lisp *lone, struct lone_value *linux_system_call_table, struct lone_value *value)
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    System call names are found in a static perfect hash table that     │
+   │    is generated at build time from the host's system call numbers.     │
+   │    Finding a name takes one hash, one probe and one comparison.        │
+   │    The hash is the low 32 bits of 64 bit FNV-1a on every platform      │
+   │    so that it matches the generator. See scripts/NR.generate           │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+struct linux_system_call {
+	char *symbol;
+	unsigned char length;
+	int number;
+};
+
+#include LONE_NR_SOURCE
+
+static const struct linux_system_call *lone_linux_system_call_find(struct lone_bytes name)
 {
-	switch (value->type) {
+	const struct linux_system_call *system_call;
+	unsigned long hash = 0x84222325UL, bucket, slot;
+	size_t i;
+
+	for (i = 0; i < name.count; ++i) {
+		hash = ((hash ^ name.pointer[i]) * 0x1B3UL) & 0xFFFFFFFFUL;
+	}
+
+	bucket = hash % LINUX_SYSTEM_CALL_BUCKETS;
+	slot = (hash / LINUX_SYSTEM_CALL_BUCKETS + linux_system_call_displacements[bucket] * ((hash >> 16) | 1)) % LINUX_SYSTEM_CALL_SLOTS;
+	system_call = &linux_system_calls[slot];
+
+	if (!system_call->symbol || system_call->length != name.count) { return 0; }
+	if (memory_compare(system_call->symbol, name.pointer, name.count) != 0) { return 0; }
+
+	return system_call;
+}
+
+static inline long lone_value_to_linux_system_call_number(struct lone_lisp *lone, struct lone_value *value)
+{
+	const struct linux_system_call *system_call;
+
+	switch (lone_type_of(value)) {
 	case LONE_INTEGER:
-		return value->integer;
+		return lone_integer_of(value);
 	case LONE_BYTES:
 	case LONE_TEXT:
 	case LONE_SYMBOL:
-		return lone_table_get(lone, linux_system_call_table, value)->integer;
+		/* names are resolved once, literal names in code are the same value every time */
+		if (!value->system_call) {
+			system_call = lone_linux_system_call_find(value->bytes);
+			if (!system_call) { /* unknown system call: (system-call "nonexistent") */ lone_exit(lone, -1); }
+			/* bytes may be changed in place, only immutable names are cached */
+			if (value->type == LONE_BYTES) { return system_call->number; }
+			value->system_call = system_call->number + 1;
+		}
+		return value->system_call - 1;
 	case LONE_MODULE:
 	case LONE_FUNCTION:
 	case LONE_PRIMITIVE:
@@ -1945,49 +5228,156 @@ static inline long lone_value_to_linux_system_call_number(struct lone_lisp *lone
 	case LONE_VECTOR:
 	case LONE_TABLE:
 	case LONE_POINTER:
-		linux_exit(-1);
+	case LONE_READER:
+		lone_exit(lone, -1);
 	}
 }
 
-static inline long lone_value_to_linux_system_call_argument(struct lone_value *value)
+static inline long lone_value_to_linux_system_call_argument(struct lone_lisp *lone, struct lone_value *value)
 {
-	switch (value->type) {
-	case LONE_INTEGER: return value->integer;
+	switch (lone_type_of(value)) {
+	case LONE_INTEGER: return lone_integer_of(value);
 	case LONE_POINTER: return (long) value->pointer;
 	case LONE_BYTES: case LONE_TEXT: case LONE_SYMBOL: return (long) value->bytes.pointer;
 	case LONE_PRIMITIVE: return (long) value->primitive.function;
-	case LONE_FUNCTION: case LONE_LIST: case LONE_VECTOR: case LONE_TABLE: case LONE_MODULE: linux_exit(-1);
+	case LONE_FUNCTION: case LONE_LIST: case LONE_VECTOR: case LONE_TABLE: case LONE_MODULE: case LONE_READER: lone_exit(lone, -1);
 	}
 }
 
-static struct lone_value *lone_primitive_linux_system_call(struct lone_lisp *lone, struct lone_value *linux_system_call_table, struct lone_value *environment, struct lone_value *arguments)
+static struct lone_value *lone_primitive_linux_system_call(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
 {
-	struct lone_value *argument;
 	long result, number, args[6];
-	unsigned char i;
+	size_t i;
 
-	if (lone_is_nil(arguments)) { /* need at least the system call number */ linux_exit(-1); }
-	argument = lone_list_first(arguments);
-	number = lone_value_to_linux_system_call_number(lone, linux_system_call_table, argument);
-	arguments = lone_list_rest(arguments);
+	if (count == 0) { /* need at least the system call number */ lone_exit(lone, -1); }
+	if (count > 7) { /* too many arguments given */ lone_exit(lone, -1); }
+	number = lone_value_to_linux_system_call_number(lone, arguments[0]);
 
 	for (i = 0; i < 6; ++i) {
-		if (lone_is_nil(arguments)) {
-			args[i] = 0;
-		} else {
-			argument = lone_list_first(arguments);
-			args[i] = lone_value_to_linux_system_call_argument(argument);
-			arguments = lone_list_rest(arguments);
-		}
+		args[i] = i + 1 < count? lone_value_to_linux_system_call_argument(lone, arguments[i + 1]) : 0;
 	}
 
-	if (!lone_is_nil(arguments)) { /* too many arguments given */ linux_exit(-1); }
+	/* buffered output must come before anything written by the system call */
+	lone_output_flush(lone);
 
 	result = system_call_6(number, args[0], args[1], args[2], args[3], args[4], args[5]);
 
 	return lone_integer_create(lone, result);
 }
 
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    System call functions are primitives bound to a single system       │
+   │    call number. Those bound to an arity make the system call with      │
+   │    exactly that many arguments. The name is resolved only once.        │
+   │                                                                        │
+   │        (set write (system-call-function "write" 3))                    │
+   │        (write 1 "text" 4)                                              │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static inline __attribute__((always_inline)) struct lone_value *lone_linux_system_call_bound(struct lone_lisp *lone, struct lone_value *number, size_t count, struct lone_value **arguments, size_t arity)
+{
+	long n = lone_integer_of(number), result, args[6];
+	size_t i;
+
+	if (count != arity) { /* argument number mismatch: ((system-call-function "close" 1)) */ lone_exit(lone, -1); }
+
+	for (i = 0; i < arity; ++i) {
+		args[i] = lone_value_to_linux_system_call_argument(lone, arguments[i]);
+	}
+
+	/* buffered output must come before anything written by the system call */
+	lone_output_flush(lone);
+
+	switch (arity) {
+	case 0: result = system_call_0(n); break;
+	case 1: result = system_call_1(n, args[0]); break;
+	case 2: result = system_call_2(n, args[0], args[1]); break;
+	case 3: result = system_call_3(n, args[0], args[1], args[2]); break;
+	case 4: result = system_call_4(n, args[0], args[1], args[2], args[3]); break;
+	case 5: result = system_call_5(n, args[0], args[1], args[2], args[3], args[4]); break;
+	default: result = system_call_6(n, args[0], args[1], args[2], args[3], args[4], args[5]); break;
+	}
+
+	return lone_integer_create(lone, result);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_0(struct lone_lisp *lone, struct lone_value *number, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_linux_system_call_bound(lone, number, count, arguments, 0);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_1(struct lone_lisp *lone, struct lone_value *number, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_linux_system_call_bound(lone, number, count, arguments, 1);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_2(struct lone_lisp *lone, struct lone_value *number, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_linux_system_call_bound(lone, number, count, arguments, 2);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_3(struct lone_lisp *lone, struct lone_value *number, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_linux_system_call_bound(lone, number, count, arguments, 3);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_4(struct lone_lisp *lone, struct lone_value *number, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_linux_system_call_bound(lone, number, count, arguments, 4);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_5(struct lone_lisp *lone, struct lone_value *number, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_linux_system_call_bound(lone, number, count, arguments, 5);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_6(struct lone_lisp *lone, struct lone_value *number, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_linux_system_call_bound(lone, number, count, arguments, 6);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_variadic(struct lone_lisp *lone, struct lone_value *number, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *padded[6];
+	size_t i;
+
+	if (count > 6) { /* too many arguments given */ lone_exit(lone, -1); }
+
+	/* missing arguments are zero */
+	for (i = 0; i < 6; ++i) { padded[i] = i < count? arguments[i] : lone_integer_create(lone, 0); }
+
+	return lone_linux_system_call_bound(lone, number, 6, padded, 6);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_function(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	static lone_primitive_fast bound[] = {
+		lone_primitive_linux_system_call_0,
+		lone_primitive_linux_system_call_1,
+		lone_primitive_linux_system_call_2,
+		lone_primitive_linux_system_call_3,
+		lone_primitive_linux_system_call_4,
+		lone_primitive_linux_system_call_5,
+		lone_primitive_linux_system_call_6,
+	};
+	lone_primitive_fast function = lone_primitive_linux_system_call_variadic;
+	char *name = "linux_system_call";
+	long number, arity;
+
+	if (count < 1 || count > 2) { /* system call and optional arity required: (system-call-function) */ lone_exit(lone, -1); }
+	number = lone_value_to_linux_system_call_number(lone, arguments[0]);
+	if (lone_type_of(arguments[0]) != LONE_INTEGER) { name = lone_linux_system_call_find(arguments[0]->bytes)->symbol; }
+
+	if (count == 2) {
+		arity = lone_integer_argument(lone, arguments[1]);
+		if (arity < 0 || arity > 6) { /* system calls take at most 6 arguments: (system-call-function "read" 7) */ lone_exit(lone, -1); }
+		function = bound[arity];
+	}
+
+	return lone_primitive_create_fast(lone, name, function, lone_integer_create(lone, number), (struct lone_function_flags) { 1, 0, 1 });
+}
+
 /* ╭─────────────────────────┨ LONE LINUX PROCESS ┠─────────────────────────╮
    │                                                                        │
    │    Code to access all the parameters Linux passes to its processes.    │
@@ -2107,79 +5497,603 @@ static void lone_auxiliary_value_to_table(struct lone_lisp *lone, struct lone_va
 		                         lone_integer_create(lone, auxiliary_value->as.integer));
 	}
 
-	lone_table_set(lone, table, key, value);
+	lone_table_set(lone, table, key, value);
+}
+
+static struct lone_value *lone_auxiliary_vector_to_table(struct lone_lisp *lone, struct auxiliary *auxiliary_values)
+{
+	struct lone_value *table = lone_table_create(lone, 32, 0);
+	size_t i;
+
+	for (i = 0; auxiliary_values[i].type != AT_NULL; ++i) {
+		lone_auxiliary_value_to_table(lone, table, &auxiliary_values[i]);
+	}
+
+	return table;
+}
+
+static struct lone_value *lone_environment_to_table(struct lone_lisp *lone, char **c_strings)
+{
+	struct lone_value *table = lone_table_create(lone, 64, 0), *key, *value;
+	char *c_string_key, *c_string_value, *c_string;
+
+	for (/* c_strings */; *c_strings; ++c_strings) {
+		c_string = *c_strings;
+		c_string_key = c_string;
+		c_string_value = "";
+
+		while (*c_string++) {
+			if (*c_string == '=') {
+				*c_string = '\0';
+				c_string_value = c_string + 1;
+				break;
+			}
+		}
+
+		key = lone_text_create_from_c_string(lone, c_string_key);
+		value = lone_text_create_from_c_string(lone, c_string_value);
+		lone_table_set(lone, table, key, value);
+	}
+
+	return table;
+}
+
+/* returns the value of the environment variable or zero if it is not set */
+static char *lone_environment_variable(char **envp, char *name)
+{
+	size_t length = lone_c_string_length(name);
+
+	for (/* envp */; *envp; ++envp) {
+		if (lone_c_string_length(*envp) <= length || (*envp)[length] != '=') { continue; }
+		if (memory_compare(*envp, name, length) == 0) { return *envp + length + 1; }
+	}
+
+	return 0;
+}
+
+static struct lone_value *lone_arguments_to_list(struct lone_lisp *lone, int count, char **c_strings)
+{
+	struct lone_value *first = 0, *last = 0;
+	int i;
+
+	for (i = 0; i < count; ++i) {
+		last = lone_list_build(lone, &first, last, lone_text_create_from_c_string(lone, c_strings[i]));
+	}
+
+	return first? first : lone_list_create_nil(lone);
+}
+
+static struct lone_value *lone_primitive_linux_system_call_table(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *table = lone_table_create(lone, LINUX_SYSTEM_CALL_SLOTS, 0);
+	size_t i;
+
+	for (i = 0; i < LINUX_SYSTEM_CALL_SLOTS; ++i) {
+		if (!linux_system_calls[i].symbol) { continue; }
+		lone_table_set(lone, table,
+		               lone_intern_c_string(lone, linux_system_calls[i].symbol),
+		               lone_integer_create(lone, linux_system_calls[i].number));
+	}
+
+	return table;
+}
+
+static struct lone_value *lone_primitive_linux_arguments(struct lone_lisp *lone, struct lone_value *argv, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	char **c_strings = argv->pointer;
+	int argc = 0;
+
+	while (c_strings[argc]) { ++argc; }
+
+	return lone_arguments_to_list(lone, argc, c_strings);
+}
+
+static struct lone_value *lone_primitive_linux_environment(struct lone_lisp *lone, struct lone_value *envp, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_environment_to_table(lone, envp->pointer);
+}
+
+static struct lone_value *lone_primitive_linux_auxiliary_values(struct lone_lisp *lone, struct lone_value *auxv, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	return lone_auxiliary_vector_to_table(lone, auxv->pointer);
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Linux io_uring primitives for batched asynchronous input/output.    │
+   │                                                                        │
+   │    A ring is a pair of queues shared with the kernel. Operations are   │
+   │    queued in the submission ring without entering the kernel and are   │
+   │    then submitted all at once with a single system call. Results are   │
+   │    collected from the completion ring, also without system calls.      │
+   │                                                                        │
+   │        (set ring (ring 64))                                            │
+   │        (queue ring 'write 1 1 "text" 4 -1)                             │
+   │        (submit ring 1)                                                 │
+   │        (completions ring)                                              │
+   │                                                                        │
+   │    Memory given to queued operations must be kept alive by the code    │
+   │    until its operations are complete.                                  │
+   │                                                                        │
+   │    https://kernel.dk/io_uring.pdf                                      │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+struct lone_io_uring {
+	int file_descriptor;
+
+	struct {
+		unsigned *head, *tail, *mask, *entries, *array;
+		struct io_uring_sqe *queue;
+		unsigned pending;
+		void *ring;
+		size_t size;
+	} submission;
+
+	struct {
+		unsigned *head, *tail, *mask;
+		struct io_uring_cqe *queue;
+		void *ring;
+		size_t size;
+	} completion;
+};
+
+static void *lone_io_uring_map(struct lone_lisp *lone, int fd, size_t size, long offset)
+{
+	void *ring = linux_mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+	if (linux_is_error((long) ring)) { /* could not map io_uring memory */ lone_exit(lone, -1); }
+	return ring;
+}
+
+static struct lone_io_uring *lone_io_uring_argument(struct lone_lisp *lone, struct lone_value *value)
+{
+	struct lone_io_uring *ring;
+
+	if (lone_type_of(value) != LONE_POINTER || !value->io_uring) { /* not a ring: (submit 10), (submit vDSO) */ lone_exit(lone, -1); }
+	ring = value->pointer;
+	if (ring->file_descriptor < 0) { /* ring was closed: (submit closed-ring) */ lone_exit(lone, -1); }
+
+	return ring;
+}
+
+static long lone_io_uring_submit(struct lone_lisp *lone, struct lone_io_uring *ring, unsigned wait)
+{
+	long submitted;
+
+	/* buffered output must come before anything written by queued operations */
+	lone_output_flush(lone);
+
+	submitted = linux_io_uring_enter(ring->file_descriptor, ring->submission.pending, wait, wait? IORING_ENTER_GETEVENTS : 0);
+	if (!linux_is_error(submitted)) { ring->submission.pending -= submitted; }
+
+	return submitted;
+}
+
+static struct lone_value *lone_primitive_io_uring_ring(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct io_uring_params parameters;
+	struct lone_io_uring *ring;
+	struct lone_value *value;
+	unsigned char *submission, *completion;
+	long entries;
+	int fd;
+
+	if (count != 1) { /* entry count required: (ring) */ lone_exit(lone, -1); }
+	entries = lone_integer_argument(lone, arguments[0]);
+	if (entries < 1) { /* ring must have entries: (ring 0) */ lone_exit(lone, -1); }
+
+	lone_memory_zero(&parameters, sizeof(parameters));
+	fd = linux_io_uring_setup(entries, &parameters);
+	if (linux_is_error(fd)) { /* io_uring not available or too many entries */ lone_exit(lone, -1); }
+
+	ring = lone_allocate(lone, sizeof(*ring));
+	ring->file_descriptor = fd;
+
+	ring->submission.size = parameters.sq_off.array + parameters.sq_entries * sizeof(unsigned);
+	ring->submission.ring = submission = lone_io_uring_map(lone, fd, ring->submission.size, IORING_OFF_SQ_RING);
+	ring->submission.head = (unsigned *) (submission + parameters.sq_off.head);
+	ring->submission.tail = (unsigned *) (submission + parameters.sq_off.tail);
+	ring->submission.mask = (unsigned *) (submission + parameters.sq_off.ring_mask);
+	ring->submission.entries = (unsigned *) (submission + parameters.sq_off.ring_entries);
+	ring->submission.array = (unsigned *) (submission + parameters.sq_off.array);
+	ring->submission.queue = lone_io_uring_map(lone, fd, parameters.sq_entries * sizeof(struct io_uring_sqe), IORING_OFF_SQES);
+	ring->submission.pending = 0;
+
+	ring->completion.size = parameters.cq_off.cqes + parameters.cq_entries * sizeof(struct io_uring_cqe);
+	ring->completion.ring = completion = lone_io_uring_map(lone, fd, ring->completion.size, IORING_OFF_CQ_RING);
+	ring->completion.head = (unsigned *) (completion + parameters.cq_off.head);
+	ring->completion.tail = (unsigned *) (completion + parameters.cq_off.tail);
+	ring->completion.mask = (unsigned *) (completion + parameters.cq_off.ring_mask);
+	ring->completion.queue = (struct io_uring_cqe *) (completion + parameters.cq_off.cqes);
+
+	value = lone_pointer_create(lone, ring);
+	value->io_uring = 1;
+	return value;
+}
+
+/* ╭────────────────────────────────────────────────────────────────────────╮
+   │                                                                        │
+   │    Operations are queued with up to six optional fields which are      │
+   │    converted like system call arguments. Their meaning depends on      │
+   │    the operation, just like the arguments of the system calls:         │
+   │                                                                        │
+   │        (queue ring operation user-data fd address length offset flags) │
+   │                                                                        │
+   │    The user data identifies the operation's completion. Full rings     │
+   │    are submitted to the kernel in order to make room for more.         │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+static struct lone_value *lone_primitive_io_uring_queue(struct lone_lisp *lone, struct lone_value *operations, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_io_uring *ring;
+	struct io_uring_sqe *entry;
+	struct lone_value *operation;
+	unsigned tail, index;
+	long fields[6];
+	size_t i;
+
+	if (count < 2 || count > 8) { /* ring, operation and up to 6 fields required: (queue ring) */ lone_exit(lone, -1); }
+	ring = lone_io_uring_argument(lone, arguments[0]);
+
+	operation = arguments[1];
+	switch (lone_type_of(operation)) {
+	case LONE_SYMBOL:
+	case LONE_TEXT:
+		operation = lone_table_get(lone, operations, operation);
+		if (lone_is_nil(operation)) { /* unknown operation: (queue ring 'nonexistent) */ lone_exit(lone, -1); }
+		break;
+	case LONE_INTEGER:
+		break;
+	case LONE_MODULE:
+	case LONE_FUNCTION:
+	case LONE_PRIMITIVE:
+	case LONE_BYTES:
+	case LONE_LIST:
+	case LONE_VECTOR:
+	case LONE_TABLE:
+	case LONE_POINTER:
+	case LONE_READER:
+		/* operation not an integer or name: (queue ring ()) */ lone_exit(lone, -1);
+	}
+
+	for (i = 0; i < 6; ++i) {
+		fields[i] = i + 2 < count? lone_value_to_linux_system_call_argument(lone, arguments[i + 2]) : 0;
+	}
+
+	tail = *ring->submission.tail;
+	if (tail - __atomic_load_n(ring->submission.head, __ATOMIC_ACQUIRE) >= *ring->submission.entries) {
+		lone_io_uring_submit(lone, ring, 0);
+		if (tail - __atomic_load_n(ring->submission.head, __ATOMIC_ACQUIRE) >= *ring->submission.entries) {
+			/* kernel did not consume the full ring */ lone_exit(lone, -1);
+		}
+	}
+
+	index = tail & *ring->submission.mask;
+	entry = &ring->submission.queue[index];
+	lone_memory_zero(entry, sizeof(*entry));
+
+	entry->opcode = lone_integer_of(operation);
+	entry->user_data = fields[0];
+	entry->fd = fields[1];
+	entry->addr = fields[2];
+	entry->len = fields[3];
+	entry->off = fields[4];
+	entry->rw_flags = fields[5];
+
+	ring->submission.array[index] = index;
+	__atomic_store_n(ring->submission.tail, tail + 1, __ATOMIC_RELEASE);
+	++ring->submission.pending;
+
+	return lone_integer_create(lone, ring->submission.pending);
+}
+
+static struct lone_value *lone_primitive_io_uring_submit(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_io_uring *ring;
+	long wait = 0;
+
+	if (count < 1 || count > 2) { /* ring and optional completion count required: (submit) */ lone_exit(lone, -1); }
+	ring = lone_io_uring_argument(lone, arguments[0]);
+	if (count == 2) { wait = lone_integer_argument(lone, arguments[1]); }
+	if (wait < 0) { /* negative completion count: (submit ring -1) */ lone_exit(lone, -1); }
+
+	return lone_integer_create(lone, lone_io_uring_submit(lone, ring, wait));
+}
+
+/* each completion is a list of user data and result: ((1 4) (2 -9)) */
+static struct lone_value *lone_primitive_io_uring_completions(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_value *first = 0, *last = 0, *completion[2];
+	struct lone_io_uring *ring;
+	struct io_uring_cqe *entry;
+	unsigned head, tail;
+
+	if (count != 1) { /* ring required: (completions) */ lone_exit(lone, -1); }
+	ring = lone_io_uring_argument(lone, arguments[0]);
+
+	head = *ring->completion.head;
+	tail = __atomic_load_n(ring->completion.tail, __ATOMIC_ACQUIRE);
+
+	for (/* head */; head != tail; ++head) {
+		entry = &ring->completion.queue[head & *ring->completion.mask];
+		completion[0] = lone_integer_create(lone, (long) entry->user_data);
+		completion[1] = lone_integer_create(lone, entry->res);
+		last = lone_list_build(lone, &first, last, lone_list_from_values(lone, completion, 2));
+	}
+
+	__atomic_store_n(ring->completion.head, head, __ATOMIC_RELEASE);
+
+	return first? first : lone_list_create_nil(lone);
 }
 
-static struct lone_value *lone_auxiliary_vector_to_table(struct lone_lisp *lone, struct auxiliary *auxiliary_values)
+/* the description is kept so that using a closed ring is an error */
+static struct lone_value *lone_primitive_io_uring_close(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
 {
-	struct lone_value *table = lone_table_create(lone, 32, 0);
-	size_t i;
+	struct lone_io_uring *ring;
 
-	for (i = 0; auxiliary_values[i].type != AT_NULL; ++i) {
-		lone_auxiliary_value_to_table(lone, table, &auxiliary_values[i]);
+	if (count != 1) { /* ring required: (close) */ lone_exit(lone, -1); }
+	ring = lone_io_uring_argument(lone, arguments[0]);
+
+	linux_munmap(ring->submission.queue, *ring->submission.entries * sizeof(struct io_uring_sqe));
+	linux_munmap(ring->submission.ring, ring->submission.size);
+	linux_munmap(ring->completion.ring, ring->completion.size);
+	linux_close(ring->file_descriptor);
+	ring->file_descriptor = -1;
+
+	return lone_list_create_nil(lone);
+}
+
+/* ╭─────────────────────────┨ LONE LISP IMAGES ┠───────────────────────────╮
+   │                                                                        │
+   │    An image is a copy of an interpreter and all of its memory.         │
+   │    Lone resumes the image named by the LONE_IMAGE environment          │
+   │    variable instead of initializing a new interpreter. The memory      │
+   │    is mapped copy-on-write at the addresses it was saved from so       │
+   │    nothing needs to be relocated and startup is just the mapping.      │
+   │    Lone is linked statically at a fixed address and values point       │
+   │    into it, at primitives and interned C strings for example. Only     │
+   │    the executable which saved an image can resume it, which is         │
+   │    checked against a hash of its code. Images it rejects or cannot     │
+   │    map are ignored and lone initializes itself as usual.               │
+   │                                                                        │
+   │    Images are saved by the snapshot primitive, usually at the end      │
+   │    of a prelude which imports and defines what programs need. The      │
+   │    bytes borrowed from files read by lone are copied into the heap     │
+   │    first since the files are not part of the image. The linux          │
+   │    module is updated for the new process when it is resumed.           │
+   │    Values computed from the old process, open file descriptors,        │
+   │    readers and io_uring rings are not.                                 │
+   │                                                                        │
+   │        image   ┃ magic ┃ executable ┃ count ┃ interpreter ┃            │
+   │        regions ┃ address, size, offset ┃ ...                           │
+   │        memory  ┃ page aligned contents of each region ┃ ...            │
+   │                                                                        │
+   ╰────────────────────────────────────────────────────────────────────────╯ */
+#define LONE_IMAGE_MAXIMUM_REGIONS 4096
+
+/* file offsets must be page aligned for mmap and aarch64 pages may be as large as 64 KiB */
+#define LONE_IMAGE_ALIGNMENT (64 * 1024)
+
+static const char lone_image_magic[8] = "LONEIMG";
+
+/* defined by the linker, the headers and code of the executable come first */
+extern unsigned char __executable_start[], _etext[], _end[];
+
+struct lone_image_region {
+	unsigned char *address;
+	size_t size;
+	long offset;                 /* of its contents in the image */
+};
+
+struct lone_image {
+	char magic[sizeof(lone_image_magic)];
+	unsigned long executable;    /* hash of the code of the executable which saved it */
+	size_t count;                /* of the regions which follow */
+	struct lone_lisp lone;
+};
+
+static void lone_builtin_module_linux_process(struct lone_lisp *, struct lone_value *, int, char **, char **, struct auxiliary *);
+
+static unsigned long lone_image_executable(void)
+{
+	unsigned long *word = (unsigned long *) __executable_start, hash = FNV_OFFSET_BASIS;
+
+	/* a word at a time since it is done whenever lone starts with an image */
+	while (word < (unsigned long *) _etext) {
+		hash ^= *word++;
+		hash *= FNV_PRIME;
 	}
 
-	return table;
+	return hash;
 }
 
-static struct lone_value *lone_environment_to_table(struct lone_lisp *lone, char **c_strings)
+static int lone_image_has_bytes(struct lone_value *value)
 {
-	struct lone_value *table = lone_table_create(lone, 64, 0), *key, *value;
-	char *c_string_key, *c_string_value, *c_string;
+	switch (value->type) {
+	case LONE_BYTES:
+	case LONE_TEXT:
+	case LONE_SYMBOL:
+		return 1;
+	case LONE_MODULE:
+	case LONE_FUNCTION:
+	case LONE_PRIMITIVE:
+	case LONE_LIST:
+	case LONE_VECTOR:
+	case LONE_TABLE:
+	case LONE_INTEGER:
+	case LONE_POINTER:
+	case LONE_READER:
+		return 0;
+	}
+}
 
-	for (/* c_strings */; *c_strings; ++c_strings) {
-		c_string = *c_strings;
-		c_string_key = c_string;
-		c_string_value = "";
+static int lone_image_is_external(struct lone_value *value)
+{
+	unsigned char *pointer = value->bytes.pointer;
 
-		while (*c_string++) {
-			if (*c_string == '=') {
-				*c_string = '\0';
-				c_string_value = c_string + 1;
-				break;
-			}
-		}
+	/* the executable is part of every image, slices share the memory of their owners */
+	return value->borrowed && !value->owner && (pointer < __executable_start || pointer >= _end);
+}
 
-		key = lone_text_create_from_c_string(lone, c_string_key);
-		value = lone_text_create_from_c_string(lone, c_string_value);
-		lone_table_set(lone, table, key, value);
+static void lone_image_own_bytes(struct lone_lisp *lone, int slices)
+{
+	struct lone_value_slab *slab;
+	struct lone_value *value;
+	unsigned char *copy;
+	size_t i;
+
+	for (slab = lone->values.slabs; slab; slab = slab->next) {
+		for (i = 0; i < LONE_VALUE_SLAB_SLOTS; ++i) {
+			value = &slab->values[i];
+			if (!lone_bitmap_test(slab->allocated, i) || !lone_image_has_bytes(value)) { continue; }
+			if (slices? !value->owner || !lone_image_is_external(value->owner) : !lone_image_is_external(value)) { continue; }
+
+			copy = lone_allocate(lone, value->bytes.count);
+			lone_memory_move(value->bytes.pointer, copy, value->bytes.count);
+			value->bytes.pointer = copy;
+			value->borrowed = 0;
+			value->owner = 0;
+		}
 	}
+}
 
-	return table;
+static int lone_image_write(int fd, void *pointer, size_t size)
+{
+	struct iovec vector = { pointer, size };
+	return lone_output_write_all(fd, &vector, 1);
 }
 
-static struct lone_value *lone_arguments_to_list(struct lone_lisp *lone, int count, char **c_strings)
+static int lone_image_save(struct lone_lisp *lone, char *path)
 {
-	struct lone_value *arguments = lone_list_create_nil(lone), *head;
-	int i;
+	struct lone_memory_region *region;
+	struct lone_image image;
+	size_t count, i;
+	long offset;
+	int fd, saved;
+
+	lone_output_flush(lone);
+
+	/* slices are detached from their owners before the owners are copied */
+	lone_image_own_bytes(lone, 1);
+	lone_image_own_bytes(lone, 0);
+
+	/* nothing may be allocated from here on or the image would be inconsistent */
+	for (count = 1, region = lone->memory.regions; region; region = region->next) { ++count; }
+
+	struct lone_image_region regions[count];
+	offset = sizeof(image) + sizeof(regions);
+
+	regions[0].address = lone->memory.initial.pointer;
+	regions[0].size = lone->memory.initial.size;
+	for (i = 1, region = lone->memory.regions; region; region = region->next, ++i) {
+		regions[i].address = (unsigned char *) region;
+		regions[i].size = region->size;
+	}
+	for (i = 0; i < count; ++i) {
+		offset = (offset + LONE_IMAGE_ALIGNMENT - 1) & -LONE_IMAGE_ALIGNMENT;
+		regions[i].offset = offset;
+		offset += regions[i].size;
+	}
+
+	lone_memory_move((void *) lone_image_magic, image.magic, sizeof(image.magic));
+	image.executable = lone_image_executable();
+	image.count = count;
+	lone_memory_move(lone, &image.lone, sizeof(image.lone));
+
+	fd = linux_open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (linux_is_error(fd)) { return 0; }
 
-	for (i = 0, head = arguments; i < count; ++i) {
-		lone_list_set(head, lone_text_create_from_c_string(lone, c_strings[i]));
-		head = lone_list_append(head, lone_list_create_nil(lone));
+	saved = lone_image_write(fd, &image, sizeof(image)) && lone_image_write(fd, regions, sizeof(regions));
+	for (i = 0; saved && i < count; ++i) {
+		saved = !linux_is_error(linux_lseek(fd, regions[i].offset, SEEK_SET)) &&
+		        lone_image_write(fd, regions[i].address, regions[i].size);
 	}
 
-	return arguments;
+	linux_close(fd);
+	return saved;
+}
+
+static int lone_image_map(struct lone_image_region *region, int fd, int flags)
+{
+	void *mapping = linux_mmap(region->address, region->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | flags, fd, region->offset);
+
+	if (mapping == region->address) { return 1; }
+
+	/* kernels older than 4.17 map elsewhere instead of failing */
+	if (!linux_is_error((long) mapping)) { linux_munmap(mapping, region->size); }
+	return 0;
 }
 
-static void lone_fill_linux_system_call_table(struct lone_lisp *lone, struct lone_value *linux_system_call_table)
+static int lone_image_load(struct lone_image *image, int fd, unsigned char *memory, size_t size)
 {
 	size_t i;
 
-	static struct linux_system_call {
-		char *symbol;
-		int number;
-	} linux_system_calls[] = {
+	if (linux_read(fd, image, sizeof(*image)) != (ssize_t) sizeof(*image)) { return 0; }
+	if (memory_compare(image->magic, lone_image_magic, sizeof(image->magic)) != 0) { return 0; }
+	if (image->executable != lone_image_executable()) { return 0; }
+	if (image->count < 1 || image->count > LONE_IMAGE_MAXIMUM_REGIONS) { return 0; }
 
-		/* huge generated array initializer with all the system calls found on the host platform */
-		#include LONE_NR_SOURCE
+	struct lone_image_region regions[image->count];
+	if (linux_read(fd, regions, sizeof(regions)) != (ssize_t) sizeof(regions)) { return 0; }
 
-	};
+	/* the first region is the initial memory which belongs to the executable */
+	if (regions[0].address != memory || regions[0].size != size) { return 0; }
 
-	for (i = 0; i < (sizeof(linux_system_calls)/sizeof(linux_system_calls[0])); ++i) {
-		lone_table_set(lone, linux_system_call_table,
-		               lone_intern_c_string(lone, linux_system_calls[i].symbol),
-		               lone_integer_create(lone, linux_system_calls[i].number));
+	for (i = 1; i < image->count; ++i) {
+		if (!lone_image_map(&regions[i], fd, MAP_FIXED_NOREPLACE)) { break; }
 	}
+
+	/* the initial memory is replaced last since that cannot be undone */
+	if (i == image->count && lone_image_map(&regions[0], fd, MAP_FIXED)) { return 1; }
+
+	while (--i) { linux_munmap(regions[i].address, regions[i].size); }
+	return 0;
+}
+
+static int lone_image_resume(struct lone_lisp *lone, char *path, unsigned char *memory, size_t size, void *native_stack,
+                             int argc, char **argv, char **envp, struct auxiliary *auxv)
+{
+	struct lone_image image;
+	int fd, loaded;
+
+	fd = linux_open(path, O_RDONLY, 0);
+	if (linux_is_error(fd)) { return 0; }
+	loaded = lone_image_load(&image, fd, memory, size);
+	linux_close(fd);
+	if (!loaded) { return 0; }
+
+	lone_memory_move(&image.lone, lone, sizeof(*lone));
+
+	/* the native stack, output and profile belong to the process which saved the image */
+	lone->native_stack = native_stack;
+	lone->tail.environment = 0;
+	lone->output.file_descriptor = -1;
+	lone->output.count = 0;
+	lone->profiler.enabled = 0;
+	lone->profiler.last = 0;
+	lone->profiler.root = lone->profiler.current = lone->profiler.all = 0;
+	lone->profiler.count = 0;
+
+	lone_builtin_module_linux_process(lone,
+	                                  lone_table_get(lone, lone->modules.loaded, lone_intern_c_string(lone, "linux")),
+	                                  argc, argv, envp, auxv);
+
+	return 1;
+}
+
+static struct lone_value *lone_primitive_snapshot(struct lone_lisp *lone, struct lone_value *closure, struct lone_value *environment, size_t count, struct lone_value **arguments)
+{
+	struct lone_bytes name;
+
+	if (count != 1) { /* image path required: (snapshot) */ lone_exit(lone, -1); }
+	name = lone_bytes_like_argument(lone, arguments[0]);
+
+	char path[name.count + 1];
+	lone_memory_move(name.pointer, path, name.count);
+	path[name.count] = '\0';
+
+	if (!lone_image_save(lone, path)) { /* image could not be written: (snapshot "/") */ lone_exit(lone, -1); }
+
+	return lone_list_create_nil(lone);
 }
 
 /* ╭─────────────────────────┨ LONE LISP MODULES ┠──────────────────────────╮
@@ -2187,44 +6101,152 @@ static void lone_fill_linux_system_call_table(struct lone_lisp *lone, struct lon
    │    Built-in modules containing essential functionality.                │
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
+/* the members which describe the process are replaced when an image is resumed */
+static void lone_builtin_module_linux_process(struct lone_lisp *lone, struct lone_value *module, int argc, char **argv, char **envp, struct auxiliary *auxv)
+{
+	struct lone_value *arguments = lone_intern_c_string(lone, "arguments"),
+	                  *environment = lone_intern_c_string(lone, "environment"),
+	                  *auxiliary_values = lone_intern_c_string(lone, "auxiliary-values");
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "argument-count"),
+	                     lone_integer_create(lone, argc));
+
+	/* these are only created if they are imported, again if they were imported by a saved image */
+
+	lone_table_delete(lone, module->module.environment, arguments);
+	lone_module_defer(lone, module,
+	                  arguments,
+	                  lone_primitive_create_fast(lone,
+	                                             "linux_arguments",
+	                                             lone_primitive_linux_arguments,
+	                                             lone_pointer_create(lone, argv),
+	                                             (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_delete(lone, module->module.environment, environment);
+	lone_module_defer(lone, module,
+	                  environment,
+	                  lone_primitive_create_fast(lone,
+	                                             "linux_environment",
+	                                             lone_primitive_linux_environment,
+	                                             lone_pointer_create(lone, envp),
+	                                             (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_delete(lone, module->module.environment, auxiliary_values);
+	lone_module_defer(lone, module,
+	                  auxiliary_values,
+	                  lone_primitive_create_fast(lone,
+	                                             "linux_auxiliary_values",
+	                                             lone_primitive_linux_auxiliary_values,
+	                                             lone_pointer_create(lone, auxv),
+	                                             (struct lone_function_flags) { 1, 0, 1 }));
+}
+
 static void lone_builtin_module_linux_initialize(struct lone_lisp *lone, int argc, char **argv, char **envp, struct auxiliary *auxv)
 {
 	struct lone_value *name = lone_intern_c_string(lone, "linux"),
-	                  *module = lone_module_create(lone, name),
-	                  *linux_system_call_table = lone_table_create(lone, 1024, 0),
-	                  *count, *arguments, *environment, *auxiliary_values;
+	                  *module = lone_module_create(lone, name);
 
 	lone_table_set(lone, module->module.environment,
 	                     lone_intern_c_string(lone, "system-call"),
-	                     lone_primitive_create(lone,
-	                                           "linux_system_call",
-	                                           lone_primitive_linux_system_call,
-	                                           linux_system_call_table,
-	                                           (struct lone_function_flags) { 1, 0, 1 }));
+	                     lone_primitive_create_fast(lone,
+	                                                "linux_system_call",
+	                                                lone_primitive_linux_system_call,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
 
 	lone_table_set(lone, module->module.environment,
-	                     lone_intern_c_string(lone, "system-call-table"),
-	                     linux_system_call_table);
+	                     lone_intern_c_string(lone, "system-call-function"),
+	                     lone_primitive_create_fast(lone,
+	                                                "linux_system_call_function",
+	                                                lone_primitive_linux_system_call_function,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	/* these are only created if they are imported */
+
+	lone_module_defer(lone, module,
+	                  lone_intern_c_string(lone, "system-call-table"),
+	                  lone_primitive_create_fast(lone,
+	                                             "linux_system_call_table",
+	                                             lone_primitive_linux_system_call_table,
+	                                             module,
+	                                             (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_builtin_module_linux_process(lone, module, argc, argv, envp, auxv);
+
+	lone_table_set(lone, lone->modules.loaded, name, module);
+}
+
+static void lone_io_uring_operation(struct lone_lisp *lone, struct lone_value *operations, char *name, int operation)
+{
+	lone_table_set(lone, operations, lone_intern_c_string(lone, name), lone_integer_create(lone, operation));
+}
+
+static void lone_builtin_module_io_uring_initialize(struct lone_lisp *lone)
+{
+	struct lone_value *name = lone_intern_c_string(lone, "io-uring"),
+	                  *module = lone_module_create(lone, name),
+	                  *operations = lone_table_create(lone, 32, 0);
+
+	lone_io_uring_operation(lone, operations, "nop", IORING_OP_NOP);
+	lone_io_uring_operation(lone, operations, "readv", IORING_OP_READV);
+	lone_io_uring_operation(lone, operations, "writev", IORING_OP_WRITEV);
+	lone_io_uring_operation(lone, operations, "fsync", IORING_OP_FSYNC);
+	lone_io_uring_operation(lone, operations, "poll", IORING_OP_POLL_ADD);
+	lone_io_uring_operation(lone, operations, "accept", IORING_OP_ACCEPT);
+	lone_io_uring_operation(lone, operations, "connect", IORING_OP_CONNECT);
+	lone_io_uring_operation(lone, operations, "openat", IORING_OP_OPENAT);
+	lone_io_uring_operation(lone, operations, "close", IORING_OP_CLOSE);
+	lone_io_uring_operation(lone, operations, "statx", IORING_OP_STATX);
+	lone_io_uring_operation(lone, operations, "read", IORING_OP_READ);
+	lone_io_uring_operation(lone, operations, "write", IORING_OP_WRITE);
+	lone_io_uring_operation(lone, operations, "send", IORING_OP_SEND);
+	lone_io_uring_operation(lone, operations, "recv", IORING_OP_RECV);
 
-	lone_fill_linux_system_call_table(lone, linux_system_call_table);
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "operations"),
+	                     operations);
 
-	count = lone_integer_create(lone, argc);
-	arguments = lone_arguments_to_list(lone, argc, argv);
-	environment = lone_environment_to_table(lone, envp);
-	auxiliary_values = lone_auxiliary_vector_to_table(lone, auxv);
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "ring"),
+	                     lone_primitive_create_fast(lone,
+	                                                "io_uring_ring",
+	                                                lone_primitive_io_uring_ring,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
 
 	lone_table_set(lone, module->module.environment,
-	                     lone_intern_c_string(lone, "argument-count"),
-	                     count);
+	                     lone_intern_c_string(lone, "queue"),
+	                     lone_primitive_create_fast(lone,
+	                                                "io_uring_queue",
+	                                                lone_primitive_io_uring_queue,
+	                                                operations,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
 	lone_table_set(lone, module->module.environment,
-	                     lone_intern_c_string(lone, "arguments"),
-	                     arguments);
+	                     lone_intern_c_string(lone, "submit"),
+	                     lone_primitive_create_fast(lone,
+	                                                "io_uring_submit",
+	                                                lone_primitive_io_uring_submit,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
 	lone_table_set(lone, module->module.environment,
-	                     lone_intern_c_string(lone, "environment"),
-	                     environment);
+	                     lone_intern_c_string(lone, "completions"),
+	                     lone_primitive_create_fast(lone,
+	                                                "io_uring_completions",
+	                                                lone_primitive_io_uring_completions,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
 	lone_table_set(lone, module->module.environment,
-	                     lone_intern_c_string(lone, "auxiliary-values"),
-	                     auxiliary_values);
+	                     lone_intern_c_string(lone, "close"),
+	                     lone_primitive_create_fast(lone,
+	                                                "io_uring_close",
+	                                                lone_primitive_io_uring_close,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
 
 	lone_table_set(lone, lone->modules.loaded, name, module);
 }
@@ -2232,39 +6254,272 @@ static void lone_builtin_module_linux_initialize(struct lone_lisp *lone, int arg
 static void lone_builtin_module_math_initialize(struct lone_lisp *lone)
 {
 	struct lone_value *name = lone_intern_c_string(lone, "math"),
-	                  *module = lone_module_create(lone, name);
+	                  *module = lone_module_create(lone, name),
+	                  *truth = lone_intern_c_string(lone, "true");
 
 	lone_table_set(lone, module->module.environment,
 	                     lone_intern_c_string(lone, "+"),
-	                     lone_primitive_create(lone,
-	                                           "add",
-	                                           lone_primitive_add,
-	                                           module,
-	                                           (struct lone_function_flags) { 1, 0, 1 }));
+	                     lone_primitive_create_fast(lone,
+	                                                "add",
+	                                                lone_primitive_add,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
 
 	lone_table_set(lone, module->module.environment,
 	                     lone_intern_c_string(lone, "-"),
-	                     lone_primitive_create(lone,
-	                                           "subtract",
-	                                           lone_primitive_subtract,
-	                                           module,
-	                                           (struct lone_function_flags) { 1, 0, 1 }));
+	                     lone_primitive_create_fast(lone,
+	                                                "subtract",
+	                                                lone_primitive_subtract,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
 
 	lone_table_set(lone, module->module.environment,
 	                     lone_intern_c_string(lone, "*"),
-	                     lone_primitive_create(lone,
-	                                           "multiply",
-	                                           lone_primitive_multiply,
-	                                           module,
-	                                           (struct lone_function_flags) { 1, 0, 1 }));
+	                     lone_primitive_create_fast(lone,
+	                                                "multiply",
+	                                                lone_primitive_multiply,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
 
 	lone_table_set(lone, module->module.environment,
 	                     lone_intern_c_string(lone, "/"),
-	                     lone_primitive_create(lone,
-	                                           "divide",
-	                                           lone_primitive_divide,
-	                                           module,
-	                                           (struct lone_function_flags) { 1, 0, 1 }));
+	                     lone_primitive_create_fast(lone,
+	                                                "divide",
+	                                                lone_primitive_divide,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "%"),
+	                     lone_primitive_create_fast(lone,
+	                                                "remainder",
+	                                                lone_primitive_remainder,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "&"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bitwise_and",
+	                                                lone_primitive_bitwise_and,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "|"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bitwise_or",
+	                                                lone_primitive_bitwise_or,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "^"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bitwise_xor",
+	                                                lone_primitive_bitwise_xor,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "<<"),
+	                     lone_primitive_create_fast(lone,
+	                                                "shift_left",
+	                                                lone_primitive_shift_left,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, ">>"),
+	                     lone_primitive_create_fast(lone,
+	                                                "shift_right",
+	                                                lone_primitive_shift_right,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "<"),
+	                     lone_primitive_create_fast(lone,
+	                                                "less_than",
+	                                                lone_primitive_less_than,
+	                                                truth,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "<="),
+	                     lone_primitive_create_fast(lone,
+	                                                "less_than_or_equal",
+	                                                lone_primitive_less_than_or_equal,
+	                                                truth,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, ">"),
+	                     lone_primitive_create_fast(lone,
+	                                                "greater_than",
+	                                                lone_primitive_greater_than,
+	                                                truth,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, ">="),
+	                     lone_primitive_create_fast(lone,
+	                                                "greater_than_or_equal",
+	                                                lone_primitive_greater_than_or_equal,
+	                                                truth,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "="),
+	                     lone_primitive_create_fast(lone,
+	                                                "equal",
+	                                                lone_primitive_equal,
+	                                                truth,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, lone->modules.loaded, name, module);
+}
+
+static void lone_builtin_module_bytes_initialize(struct lone_lisp *lone)
+{
+	struct lone_value *name = lone_intern_c_string(lone, "bytes"),
+	                  *module = lone_module_create(lone, name);
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "allocate"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bytes_allocate",
+	                                                lone_primitive_bytes_allocate,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "count"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bytes_count",
+	                                                lone_primitive_bytes_count,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "slice"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bytes_slice",
+	                                                lone_primitive_bytes_slice,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "load"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bytes_load",
+	                                                lone_primitive_bytes_load,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "load-signed"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bytes_load_signed",
+	                                                lone_primitive_bytes_load_signed,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "store"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bytes_store",
+	                                                lone_primitive_bytes_store,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "fill"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bytes_fill",
+	                                                lone_primitive_bytes_fill,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "copy"),
+	                     lone_primitive_create_fast(lone,
+	                                                "bytes_copy",
+	                                                lone_primitive_bytes_copy,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, lone->modules.loaded, name, module);
+}
+
+static void lone_builtin_module_vector_initialize(struct lone_lisp *lone)
+{
+	struct lone_value *name = lone_intern_c_string(lone, "vector"),
+	                  *module = lone_module_create(lone, name);
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "count"),
+	                     lone_primitive_create_fast(lone,
+	                                                "vector_count",
+	                                                lone_primitive_vector_count,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "from-list"),
+	                     lone_primitive_create_fast(lone,
+	                                                "vector_from_list",
+	                                                lone_primitive_vector_from_list,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "push"),
+	                     lone_primitive_create_fast(lone,
+	                                                "vector_push",
+	                                                lone_primitive_vector_push,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "pop"),
+	                     lone_primitive_create_fast(lone,
+	                                                "vector_pop",
+	                                                lone_primitive_vector_pop,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "fill"),
+	                     lone_primitive_create_fast(lone,
+	                                                "vector_fill",
+	                                                lone_primitive_vector_fill,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "slice"),
+	                     lone_primitive_create_fast(lone,
+	                                                "vector_slice",
+	                                                lone_primitive_vector_slice,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "map"),
+	                     lone_primitive_create_fast(lone,
+	                                                "vector_map",
+	                                                lone_primitive_vector_map,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "reduce"),
+	                     lone_primitive_create_fast(lone,
+	                                                "vector_reduce",
+	                                                lone_primitive_vector_reduce,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
 
 	lone_table_set(lone, lone->modules.loaded, name, module);
 }
@@ -2280,7 +6535,7 @@ static void lone_builtin_module_lone_initialize(struct lone_lisp *lone)
 	                                           "if",
 	                                           lone_primitive_if,
 	                                           module,
-	                                           (struct lone_function_flags) { 0, 0, 0 }));
+	                                           (struct lone_function_flags) { 0, 1, 0 }));
 
 	lone_table_set(lone, module->module.environment,
 	                     lone_intern_c_string(lone, "let"),
@@ -2288,7 +6543,7 @@ static void lone_builtin_module_lone_initialize(struct lone_lisp *lone)
 	                                           "let",
 	                                           lone_primitive_let,
 	                                           module,
-	                                           (struct lone_function_flags) { 0, 0, 0 }));
+	                                           (struct lone_function_flags) { 0, 1, 0 }));
 
 	lone_table_set(lone, module->module.environment,
 	                     lone_intern_c_string(lone, "set"),
@@ -2332,11 +6587,75 @@ static void lone_builtin_module_lone_initialize(struct lone_lisp *lone)
 
 	lone_table_set(lone, module->module.environment,
 	                     lone_intern_c_string(lone, "print"),
-	                     lone_primitive_create(lone,
-	                                           "print",
-	                                           lone_primitive_print,
-	                                           module,
-	                                           (struct lone_function_flags) { 1, 0, 1 }));
+	                     lone_primitive_create_fast(lone,
+	                                                "print",
+	                                                lone_primitive_print,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "flush"),
+	                     lone_primitive_create_fast(lone,
+	                                                "flush",
+	                                                lone_primitive_flush,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "profile"),
+	                     lone_primitive_create_fast(lone,
+	                                                "profile",
+	                                                lone_primitive_profile,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "snapshot"),
+	                     lone_primitive_create_fast(lone,
+	                                                "snapshot",
+	                                                lone_primitive_snapshot,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "statistics"),
+	                     lone_primitive_create_fast(lone,
+	                                                "statistics",
+	                                                lone_primitive_statistics,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "collector-log"),
+	                     lone_primitive_create_fast(lone,
+	                                                "collector_log",
+	                                                lone_primitive_collector_log,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "reader"),
+	                     lone_primitive_create_fast(lone,
+	                                                "reader",
+	                                                lone_primitive_reader,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "feed"),
+	                     lone_primitive_create_fast(lone,
+	                                                "feed",
+	                                                lone_primitive_feed,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
+
+	lone_table_set(lone, module->module.environment,
+	                     lone_intern_c_string(lone, "read"),
+	                     lone_primitive_create_fast(lone,
+	                                                "read",
+	                                                lone_primitive_read,
+	                                                module,
+	                                                (struct lone_function_flags) { 1, 0, 1 }));
 
 	lone_table_set(lone, lone->modules.loaded, name, module);
 }
@@ -2350,29 +6669,51 @@ static void lone_builtin_module_lone_initialize(struct lone_lisp *lone)
    │                                                                        │
    │    During early initialization, lone has no dynamic memory             │
    │    allocation capabilities and so this function statically             │
-   │    allocates 64 KiB of memory for the early bootstrapping process.     │
+   │    allocates 1 MiB of memory for the early bootstrapping process.      │
+   │    Once that runs out, the allocator maps in more as needed.           │
    │                                                                        │
    ╰────────────────────────────────────────────────────────────────────────╯ */
+static void lone_profile_start_from_environment(struct lone_lisp *lone, char **envp)
+{
+	char *metric = lone_environment_variable(envp, "LONE_PROFILE");
+	struct lone_bytes name;
+
+	if (!metric) { return; }
+
+	name.pointer = (unsigned char *) metric;
+	name.count = lone_c_string_length(metric);
+	lone_profile_start(lone, lone_profile_metric_from(name));
+}
+
 long lone(int argc, char **argv, char **envp, struct auxiliary *auxv)
 {
-	#define LONE_BUFFER_SIZE 4096
 	#define LONE_MEMORY_SIZE (1024 * 1024)
-	static unsigned char memory[LONE_MEMORY_SIZE];
+	/* aligned to the largest page size so that the memory of images can be mapped over it */
+	static unsigned char __attribute__((aligned(LONE_IMAGE_ALIGNMENT))) memory[LONE_MEMORY_SIZE];
+	char *image = lone_environment_variable(envp, "LONE_IMAGE");
 	struct lone_lisp lone;
 	struct lone_reader reader;
 
-	lone_lisp_initialize(&lone, memory, sizeof(memory));
+	if (!image || !lone_image_resume(&lone, image, memory, sizeof(memory), argv, argc, argv, envp, auxv)) {
+		lone_lisp_initialize(&lone, memory, sizeof(memory), argv);
 
-	lone_builtin_module_linux_initialize(&lone, argc, argv, envp, auxv);
-	lone_builtin_module_lone_initialize(&lone);
-	lone_builtin_module_math_initialize(&lone);
+		lone_builtin_module_linux_initialize(&lone, argc, argv, envp, auxv);
+		lone_builtin_module_lone_initialize(&lone);
+		lone_builtin_module_math_initialize(&lone);
+		lone_builtin_module_bytes_initialize(&lone);
+		lone_builtin_module_vector_initialize(&lone);
+		lone_builtin_module_io_uring_initialize(&lone);
+	}
 
 	lone_reader_initialize(&lone, &reader, LONE_BUFFER_SIZE, 0);
 
+	lone_profile_start_from_environment(&lone, envp);
+
 	while (1) {
 		struct lone_value *value = lone_read(&lone, &reader);
 		if (!value) {
 			if (reader.error) {
+				lone_output_flush(&lone);
 				return -1;
 			} else {
 				break;
@@ -2380,9 +6721,10 @@ long lone(int argc, char **argv, char **envp, struct auxiliary *auxv)
 		}
 
 		value = lone_evaluate_module(&lone, lone.modules.null, value);
-
-		lone_garbage_collector(&lone);
+		lone_output_flush(&lone);
 	}
 
+	lone_output_flush(&lone);
+	lone_profile_report(&lone);
 	return 0;
 }
@@ -0,0 +1,188 @@
+#!/usr/bin/bash
+
+lone=${1:-./lone}
+benchmarks_directory=${2:-bench}
+runs="${BENCH_RUNS:-5}"
+threshold="${BENCH_THRESHOLD:-10}"
+baseline="${BENCH_BASELINE:-${benchmarks_directory}/baseline}"
+
+code=0
+
+declare -A style results baselines
+
+if [[ -t 1 ]]; then
+  style=(
+    [reset]="$(tput sgr0)"
+    [bench.info]="$(tput setaf 4)"
+    [bench.faster]="$(tput setaf 2)"
+    [bench.slower]="$(tput setaf 1)"
+  )
+fi
+
+# collections are counted by having lone log them to standard error
+collector_log="(import (lone collector-log quote)) (collector-log 'true)"
+
+declare -a perf=() time=()
+
+if command -v perf > /dev/null && perf stat -e instructions true > /dev/null 2>&1; then
+  perf=(perf stat -x , -e instructions)
+fi
+
+if [[ -x /usr/bin/time ]] && /usr/bin/time -f %M true > /dev/null 2>&1; then
+  time=(/usr/bin/time -f %M)
+fi
+
+temporary="$(mktemp -d)"
+trap 'rm -rf "${temporary}"' EXIT
+
+remove-prefix() {
+  local prefix="${1}"
+  shift
+  for path in "$@"; do
+    echo "${path#"${prefix}"}"
+  done
+}
+
+find-benchmarks() {
+  find "${1}" -type d -links 2 -print0 | sort -z
+}
+
+median() {
+  printf '%s\n' "$@" | sort -n | sed -n "$(( ($# + 1) / 2 ))p"
+}
+
+maximum() {
+  printf '%s\n' "$@" | sort -n | tail -n 1
+}
+
+# prints the wall time in nanoseconds, instructions, peak RSS in KiB and collections
+measure() {
+  local benchmark="${1}" input="${2}"
+  local start end instructions=- rss=- collections
+
+  local -a arguments=()
+  if [[ -f "${benchmark}"/arguments ]]; then
+    readarray -t arguments < "${benchmark}"/arguments
+  fi
+
+  local -a environment=()
+  if [[ -f "${benchmark}"/environment ]]; then
+    readarray -t environment < "${benchmark}"/environment
+  fi
+
+  local -a command=(env -i "${environment[@]}" "${lone}" "${arguments[@]}")
+
+  # time runs inside perf so that the peak it reports is that of lone rather than of perf
+  if (( ${#time[@]} )); then command=("${time[@]}" -o "${temporary}/time" "${command[@]}"); fi
+  if (( ${#perf[@]} )); then command=("${perf[@]}" -o "${temporary}/perf" -- "${command[@]}"); fi
+
+  start="${EPOCHREALTIME/./}"
+  "${command[@]}" < "${input}" > /dev/null 2> "${temporary}/error" || return 1
+  end="${EPOCHREALTIME/./}"
+
+  if (( ${#perf[@]} )); then instructions="$(grep instructions "${temporary}/perf" | cut -d , -f 1)"; fi
+  if (( ${#time[@]} )); then rss="$(tail -n 1 "${temporary}/time")"; fi
+  collections="$(grep -c '^collection ' "${temporary}/error")"
+
+  echo "$(( (end - start) * 1000 )) ${instructions:--} ${rss} ${collections}"
+}
+
+run-benchmark() {
+  local name="${1}" benchmark="${2}/${1}" input="${temporary}/input"
+  local -a times=() instructions=() rss=() collections=() measurement
+  local i
+
+  { printf '%s\n' "${collector_log}"; cat "${benchmark}"/input; } > "${input}"
+
+  for (( i = 0; i < runs; ++i )); do
+    read -ra measurement < <(measure "${benchmark}" "${input}" || echo FAIL)
+
+    if [[ "${measurement[0]}" == FAIL ]]; then
+      printf "%sFAIL%s %s\n" "${style[bench.slower]}" "${style[reset]}" "${name}"
+      code=1
+      return 1
+    fi
+
+    times+=("${measurement[0]}")
+    instructions+=("${measurement[1]}")
+    rss+=("${measurement[2]}")
+    collections+=("${measurement[3]}")
+  done
+
+  results["${name}"]="$(median "${times[@]}") $(median "${instructions[@]}") $(maximum "${rss[@]}") $(median "${collections[@]}")"
+}
+
+read-baseline() {
+  local name values
+
+  [[ -f "${baseline}" ]] || return 0
+
+  while read -r name values; do
+    baselines["${name}"]="${values}"
+  done < "${baseline}"
+}
+
+# compares instructions when both were counted since they are far less noisy than time
+compare() {
+  local name="${1}" current base change
+
+  [[ -n "${baselines[${name}]}" ]] || return 0
+
+  read -r -a current <<< "${results[${name}]}"
+  read -r -a base <<< "${baselines[${name}]}"
+
+  if [[ "${current[1]}" != - && "${base[1]}" != - ]]; then
+    current="${current[1]}" base="${base[1]}"
+  else
+    current="${current[0]}" base="${base[0]}"
+  fi
+
+  (( base > 0 )) || return 0
+  change=$(( (current - base) * 100 / base ))
+
+  if (( change > threshold )); then
+    printf " %s%+d%%%s" "${style[bench.slower]}" "${change}" "${style[reset]}"
+    code=1
+  elif (( change < -threshold )); then
+    printf " %s%+d%%%s" "${style[bench.faster]}" "${change}" "${style[reset]}"
+  else
+    printf " %+d%%" "${change}"
+  fi
+}
+
+report() {
+  local name values
+
+  printf "%-16s %12s %16s %12s %12s\n" benchmark "time (ms)" instructions "peak (KiB)" collections
+
+  for name in $(printf '%s\n' "${!results[@]}" | sort); do
+    read -r -a values <<< "${results[${name}]}"
+    printf "%s%-16s%s %12s %16s %12s %12s" "${style[bench.info]}" "${name}" "${style[reset]}" \
+           "$(( values[0] / 1000000 )).$(printf '%03d' $(( values[0] / 1000 % 1000 )))" \
+           "${values[1]}" "${values[2]}" "${values[3]}"
+    compare "${name}"
+    printf "\n"
+  done
+}
+
+save-baseline() {
+  local name
+
+  for name in $(printf '%s\n' "${!results[@]}" | sort); do
+    echo "${name} ${results[${name}]}"
+  done > "${baseline}"
+}
+
+read-baseline
+
+while IFS= read -r -d '' benchmark; do
+  run-benchmark "$(remove-prefix "${benchmarks_directory}/" "${benchmark}")" "${benchmarks_directory}"
+done < <(find-benchmarks "${benchmarks_directory}")
+
+report
+
+if [[ -n "${BENCH_SAVE}" ]]; then
+  save-baseline
+fi
+
+exit "${code}"